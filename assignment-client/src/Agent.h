@@ -92,6 +92,15 @@ private:
 
     ScriptEnginePointer _scriptEngine;
     EntityEditPacketSender _entityEditSender;
+    // TODO: co-located Agents each hold a full copy of the domain's entity tree
+    // via this viewer, and each one separately parses the same entity stream. A
+    // shared read-only snapshot (one subscriber per monitor process group,
+    // mapped by the others) was investigated: the tree is a graph of
+    // shared_ptrs, QStrings, and QObjects whose layouts can't live in shared
+    // memory, so sharing requires either a flat serialized snapshot that agents
+    // deserialize (saving network and parse once per group, not memory) or a
+    // from-scratch offset-based tree representation. The first is the practical
+    // step and belongs in AssignmentClientMonitor, not here.
     EntityTreeHeadlessViewer _entityViewer;
 
     MixedAudioStream _receivedAudioStream;
@@ -1028,6 +1028,13 @@ bool AssetServer::loadMappingsFromFile() {
     return true;
 }
 
+// TODO: every mapping change serializes the entire table - O(mappings) JSON build
+// plus a full-file atomic rewrite per set/delete. A journaled store (append a
+// mapping-op record per change, compact to a base file periodically, replay on
+// startup) would make edits O(1), but note the contract before changing this:
+// callers treat this function's synchronous result as the commit point and roll
+// back their in-memory change on failure, so a journal needs the same synchronous
+// durability signal per operation, not a deferred flush.
 bool AssetServer::writeMappingsToFile() {
     auto mapFilePath = _resourcesDirectory.absoluteFilePath(MAP_FILE_NAME);
 
@@ -1491,6 +1498,14 @@ std::pair<bool, AssetMeta> AssetServer::readMetaFile(AssetUtils::AssetHash hash)
 
     auto metaFileHash = it->second;
 
+    // meta files are content-addressed by the mapping, so a parsed copy keyed by
+    // that hash can never go stale - this keeps startup bake scans from re-reading
+    // and re-parsing a meta file per asset
+    auto cachedMeta = _cachedMetaFiles.constFind(metaFileHash);
+    if (cachedMeta != _cachedMetaFiles.constEnd()) {
+        return { true, cachedMeta.value() };
+    }
+
     QFile metaFile(_filesDirectory.absoluteFilePath(metaFileHash));
 
     if (metaFile.open(QIODevice::ReadOnly)) {
@@ -1518,6 +1533,8 @@ std::pair<bool, AssetMeta> AssetServer::readMetaFile(AssetUtils::AssetHash hash)
                 meta.lastBakeErrors = lastBakeErrors.toString();
                 meta.redirectTarget = redirectTarget.toString();
 
+                _cachedMetaFiles.insert(metaFileHash, meta);
+
                 return { true, meta };
             } else {
                 qCWarning(asset_server) << "Metafile for" << hash << "has either missing or malformed data.";
@@ -1552,6 +1569,8 @@ bool AssetServer::writeMetaFile(AssetUtils::AssetHash originalAssetHash, const A
         metaFile.write(metaFileJSON);
         metaFile.close();
 
+        _cachedMetaFiles.insert(metaFileHash, meta);
+
         // add a mapping to the meta file so it doesn't get deleted because it is unmapped
         auto metaFileMapping = AssetUtils::HIDDEN_BAKED_CONTENT_FOLDER + originalAssetHash + "/" + "meta.json";
 
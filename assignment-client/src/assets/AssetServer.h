@@ -146,6 +146,9 @@ private:
     std::pair<bool, AssetMeta> readMetaFile(AssetUtils::AssetHash hash);
     bool writeMetaFile(AssetUtils::AssetHash originalAssetHash, const AssetMeta& meta = AssetMeta());
 
+    // parsed meta files keyed by meta-file content hash (content-addressed, never stale)
+    QHash<AssetUtils::AssetHash, AssetMeta> _cachedMetaFiles;
+
     /// Remove baked paths when the original asset is deleteds
     void removeBakedPathsForDeletedAsset(AssetUtils::AssetHash originalAssetHash);
 
@@ -82,23 +82,24 @@ void SendAssetTask::run() {
                 // we have a valid byte range, handle it and send the asset
                 auto size = byteRange.size();
 
-                if (byteRange.fromInclusive >= 0) {
-
-                    // this range is positive, meaning we just need to seek into the file and then read from there
-                    file.seek(byteRange.fromInclusive);
-                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
-                    replyPacketList->writePrimitive(size);
-                    replyPacketList->write(file.read(size));
+                // the requested range begins here, whether expressed from the start
+                // or (negative) from the end of the file
+                qint64 rangeStart = byteRange.fromInclusive >= 0
+                    ? byteRange.fromInclusive
+                    : file.size() + byteRange.fromInclusive;
+
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
+                replyPacketList->writePrimitive(size);
+
+                // write straight from a mapping of the range into the packets, rather
+                // than staging the whole range in an intermediate buffer first
+                uchar* mapped = file.map(rangeStart, size);
+                if (mapped) {
+                    replyPacketList->write(reinterpret_cast<const char*>(mapped), size);
+                    file.unmap(mapped);
                 } else {
-                    // this range is negative, at least the first part of the read will be back into the end of the file
-
-                    // seek to the part of the file where the negative range begins
-                    file.seek(file.size() + byteRange.fromInclusive);
-
-                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
-                    replyPacketList->writePrimitive(size);
-
-                    // first write everything from the negative range to the end of the file
+                    // mapping can fail (e.g. exotic filesystems) - fall back to a read
+                    file.seek(rangeStart);
                     replyPacketList->write(file.read(size));
                 }
 
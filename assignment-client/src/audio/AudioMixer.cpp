@@ -332,6 +332,7 @@ void AudioMixer::sendStatsPacket() {
     mixStats["2_skipped_streams"] = (int)(_stats.skipped / (float)_numStatFrames);
     mixStats["2_inactive_streams"] = (int)(_stats.inactive / (float)_numStatFrames);
     mixStats["2_active_streams"] = (int)(_stats.active / (float)_numStatFrames);
+    mixStats["2_culled_out_of_range"] = (int)(_stats.culledOutOfRange / (float)_numStatFrames);
 
     mixStats["3_skippped_to_active"] = (int)(_stats.skippedToActive / (float)_numStatFrames);
     mixStats["3_skippped_to_inactive"] = (int)(_stats.skippedToInactive / (float)_numStatFrames);
@@ -343,6 +344,11 @@ void AudioMixer::sendStatsPacket() {
     mixStats["total_mixes"] = _stats.totalMixes;
     mixStats["avg_mixes_per_block"] = _stats.totalMixes / _numStatFrames;
 
+    // percentiles of per-listener mix wall time, from the per-slave histograms
+    mixStats["us_per_mix_p50"] = (int)_stats.mixTimes.estimatePercentile(0.50f);
+    mixStats["us_per_mix_p90"] = (int)_stats.mixTimes.estimatePercentile(0.90f);
+    mixStats["us_per_mix_p99"] = (int)_stats.mixTimes.estimatePercentile(0.99f);
+
     statsObject["mix_stats"] = mixStats;
 
     _numStatFrames = _numSilentPackets = 0;
@@ -463,6 +469,11 @@ void AudioMixer::start() {
         nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
             // mix across slave threads
             auto mixTimer = _mixTiming.timer();
+
+            // rebuild the spatial index over stream positions once, rather than
+            // having every listener scan every stream
+            _workerSharedData.spatialIndex.rebuild(cbegin, cend);
+
             _slavePool.mix(cbegin, cend, frame, numToRetain);
         });
 
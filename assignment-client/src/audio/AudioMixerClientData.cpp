@@ -115,6 +115,12 @@ int AudioMixerClientData::processPackets(ConcurrentAddedStreams& addedStreams) {
     }
     assert(_packetQueue.empty());
 
+    // settle the deferred jitter bookkeeping once per stream written this frame
+    for (auto& stream : _batchIngestStreams) {
+        stream->endBatchIngest();
+    }
+    _batchIngestStreams.clear();
+
     // now that we have processed all packets for this frame
     // we can prepare the sources from this client to be ready for mixing
     return checkBuffersBeforeFrameSend();
@@ -532,6 +538,13 @@ void AudioMixerClientData::processStreamPacket(ReceivedMessage& message, Concurr
     // seek to the beginning of the packet so that the next reader is in the right spot
     message.seek(0);
 
+    // defer per-packet jitter bookkeeping until the whole queue has been ingested,
+    // so a burst of packets after jitter commits its bookkeeping once per stream
+    if (!matchingStream->isBatchIngesting()) {
+        matchingStream->beginBatchIngest();
+        _batchIngestStreams.push_back(matchingStream);
+    }
+
     // check the overflow count before we parse data
     auto overflowBefore = matchingStream->getOverflowCount();
     matchingStream->parseData(message);
@@ -124,6 +124,9 @@ public:
         PositionalAudioStream* positionalStream;
         bool ignoredByListener { false };
         bool ignoringListener { false };
+        // tick counter used to refresh a dormant (silent) stream's HRTF
+        // parameters at a reduced rate
+        uint8_t dormantUpdateCounter { 0 };
 
         MixableStream(NodeIDStreamID nodeIDStreamID, PositionalAudioStream* positionalStream) :
             nodeStreamID(nodeIDStreamID), hrtf(new AudioHRTF), positionalStream(positionalStream) {};
@@ -179,6 +182,9 @@ private:
     PacketQueue _packetQueue;
 
     AudioStreamVector _audioStreams; // microphone stream from avatar has a null stream ID
+    // streams written this frame, batch-settled after the queue drains; holds a reference
+    // so a StopInjector in the same queue cannot destroy a stream before it is settled
+    std::vector<SharedStreamPointer> _batchIngestStreams;
 
     void optionallyReplicatePacket(ReceivedMessage& packet, const Node& node);
 
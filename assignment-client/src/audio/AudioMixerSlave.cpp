@@ -70,6 +70,16 @@ void AudioMixerSlave::configureMix(ConstIter begin, ConstIter end, unsigned int
     _numToRetain = numToRetain;
 }
 
+// TODO: listener clustering (one rendered mix shared by near-co-located,
+// similarly-oriented listeners, personalized per listener only for injectors
+// and echo before encode) was sized up for spectator events. It doesn't fit
+// the current slave decomposition: listeners are partitioned across slave
+// threads by the pool, so cluster members land on different slaves and a
+// shared render needs either cluster-aware partitioning in
+// AudioMixerSlavePool::mix or a cross-slave rendezvous per tick; per-listener
+// state (ignore sets, per-node gain overrides, throttling tiers) also has to
+// be provably uniform within a cluster for the shared mix to be correct.
+// Cluster assignment belongs where listeners are queued, not down here.
 void AudioMixerSlave::mix(const SharedNodePointer& node) {
     // check that the node is valid
     AudioMixerClientData* data = (AudioMixerClientData*)node->getLinkedData();
@@ -96,15 +106,22 @@ void AudioMixerSlave::mix(const SharedNodePointer& node) {
     if (node->getType() == NodeType::Agent && node->getActiveSocket()) {
         ++stats.sumListeners;
 
+        auto mixStart = p_high_resolution_clock::now();
+
         // mix the audio
         bool mixHasAudio = prepareMix(node);
 
+        auto mixEnd = p_high_resolution_clock::now();
+        stats.mixTimes.record(std::chrono::duration_cast<std::chrono::microseconds>(mixEnd - mixStart).count());
+
         // send audio packet
         if (mixHasAudio || data->shouldFlushEncoder()) {
             QByteArray encodedBuffer;
             if (mixHasAudio) {
-                // encode the audio
-                QByteArray decodedBuffer(reinterpret_cast<char*>(_bufferSamples), AudioConstants::NETWORK_FRAME_BYTES_STEREO);
+                // encode the audio, wrapping the mix buffer without copying - the
+                // encoder consumes it synchronously before the next mix overwrites it
+                QByteArray decodedBuffer = QByteArray::fromRawData(reinterpret_cast<char*>(_bufferSamples),
+                                                                   AudioConstants::NETWORK_FRAME_BYTES_STEREO);
                 data->encode(decodedBuffer, encodedBuffer);
             } else {
                 // time to flush (resets shouldFlush until the next encode)
@@ -234,6 +251,9 @@ bool shouldBeRemoved(const MixableStream& stream, const AudioMixerSlave::SharedD
             contains(sharedData.removedStreams, stream.nodeStreamID));
 };
 
+// dormant (silent) streams refresh their HRTF parameters every Nth tick; must be a power of two
+static const uint8_t DORMANT_UPDATE_INTERVAL = 8;
+
 bool shouldBeInactive(MixableStream& stream) {
     return (!stream.positionalStream->lastPopSucceeded() ||
             stream.positionalStream->getLastPopOutputLoudness() == 0.0f);
@@ -320,6 +340,10 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
 
     addStreams(*listener, *listenerData);
 
+    // range-query the shared spatial index for the streams that can actually be heard
+    // from here; anything else is culled before gain or HRTF work is done for it
+    _sharedData.spatialIndex.queryAudible(listenerAudioStream->getPosition(), _audibleStreams);
+
     // Process skipped streams
     erase_if(streams.skipped, [&](MixableStream& stream) {
         if (shouldBeRemoved(stream, _sharedData)) {
@@ -338,8 +362,12 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
         }
 
         if (!isThrottling) {
-            updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
-                                 listenerData->getMasterInjectorGain());
+            if (isOutOfRange(stream, listenerAudioStream)) {
+                resetHRTFState(stream);
+            } else {
+                updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
+                                     listenerData->getMasterInjectorGain());
+            }
         }
         return false;
     });
@@ -363,8 +391,16 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
         }
 
         if (!isThrottling) {
-            updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
-                                 listenerData->getMasterInjectorGain());
+            if (isOutOfRange(stream, listenerAudioStream)) {
+                resetHRTFState(stream);
+            } else if ((++stream.dormantUpdateCounter & (DORMANT_UPDATE_INTERVAL - 1)) == 0) {
+                // a dormant stream's parameters only matter at reactivation, where
+                // one frame of interpolation covers the jump - refresh them at a
+                // reduced rate instead of paying gain/azimuth math per tick for
+                // every silent stream against every listener
+                updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
+                                     listenerData->getMasterInjectorGain());
+            }
         }
         return false;
     });
@@ -375,10 +411,13 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
+        bool culled = isOutOfRange(stream, listenerAudioStream);
+
         if (isThrottling) {
             // we're throttling, so we need to update the approximate volume for any un-skipped streams
             // unless this is simply for an echo (in which case the approx volume is 1.0)
-            stream.approximateVolume = approximateVolume(stream, listenerAudioStream);
+            // out-of-range streams sort to the throttled tail without computing a gain
+            stream.approximateVolume = culled ? 0.0f : approximateVolume(stream, listenerAudioStream);
         } else {
             if (shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
                 addStream(stream, *listenerAudioStream, 0.0f, 0.0f, isSoloing);
@@ -387,6 +426,20 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
                 return true;
             }
 
+            if (culled) {
+                // inaudible from this listener - reset so the HRTF re-interpolates
+                // cleanly when the stream comes back into range
+                resetHRTFState(stream);
+                ++stats.culledOutOfRange;
+
+                if (shouldBeInactive(stream)) {
+                    streams.inactive.push_back(move(stream));
+                    ++stats.activeToInactive;
+                    return true;
+                }
+                return false;
+            }
+
             addStream(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(), listenerData->getMasterInjectorGain(),
                       isSoloing);
 
@@ -464,6 +517,9 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
     stats.inactive += (int)streams.inactive.size();
     stats.active += (int)streams.active.size();
 
+    // render any sources still gathered for this listener
+    flushHRTFBatch();
+
     // clear the newly ignored, un-ignored, ignoring, and un-ignoring streams now that we've processed them
     listenerData->clearStagedIgnoreChanges();
 
@@ -532,14 +588,11 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
         }
 
         if (forceSilentBlock) {
-            // call renderSilent with a forced silent block to reduce artifacts
+            // batch a forced silent block to reduce artifacts
             // (this is not done for stereo streams since they do not go through the HRTF)
             if (!streamToAdd->isStereo() && !isEcho) {
-                static int16_t silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
-                mixableStream.hrtf->render(silentMonoBlock, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                           AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-
-                ++stats.hrtfRenders;
+                static const int16_t silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
+                batchHRTFRender(mixableStream.hrtf.get(), silentMonoBlock, HRTF_DATASET_INDEX, azimuth, distance, gain);
             }
 
             return;
@@ -569,9 +622,30 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
 
         streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
-        mixableStream.hrtf->render(_bufferSamples, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                   AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-        ++stats.hrtfRenders;
+        batchHRTFRender(mixableStream.hrtf.get(), _bufferSamples, HRTF_DATASET_INDEX, azimuth, distance, gain);
+    }
+}
+
+void AudioMixerSlave::batchHRTFRender(AudioHRTF* hrtf, const int16_t* monoSamples, int index,
+                                      float azimuth, float distance, float gain) {
+    if (_hrtfBatchCount == HRTF_BATCH_SIZE) {
+        flushHRTFBatch();
+    }
+
+    // the source buffers are reused per stream, so the block is copied into per-slot storage
+    // that stays valid until the batch is flushed
+    int slot = _hrtfBatchCount++;
+    memcpy(_hrtfBatchSamples[slot], monoSamples, sizeof(_hrtfBatchSamples[slot]));
+
+    _hrtfBatch[slot] = { hrtf, _hrtfBatchSamples[slot], index, azimuth, distance, gain, LPF_DISTANCE_REF };
+}
+
+void AudioMixerSlave::flushHRTFBatch() {
+    if (_hrtfBatchCount > 0) {
+        AudioHRTF::renderBatch(_hrtfBatch, _hrtfBatchCount, _mixSamples,
+                               AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        stats.hrtfRenders += _hrtfBatchCount;
+        _hrtfBatchCount = 0;
     }
 }
 
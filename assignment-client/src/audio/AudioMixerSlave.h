@@ -26,6 +26,7 @@
 #include <PositionalAudioStream.h>
 
 #include "AudioMixerClientData.h"
+#include "AudioMixerSpatialIndex.h"
 #include "AudioMixerStats.h"
 
 class AvatarAudioStream;
@@ -39,6 +40,9 @@ public:
         AudioMixerClientData::ConcurrentAddedStreams addedStreams;
         std::vector<Node::LocalID> removedNodes;
         std::vector<NodeIDStreamID> removedStreams;
+
+        // rebuilt once per frame on the mixer thread, read-only while slaves mix
+        AudioMixerSpatialIndex spatialIndex;
     };
 
     AudioMixerSlave(SharedData& sharedData) : _sharedData(sharedData) {};
@@ -69,12 +73,35 @@ private:
                               float masterInjectorGain);
     void resetHRTFState(AudioMixerClientData::MixableStream& mixableStream);
 
+    // true when the stream cannot be heard by this listener, per the shared spatial index
+    bool isOutOfRange(const AudioMixerClientData::MixableStream& mixableStream,
+                      const AvatarAudioStream* listenerAudioStream) const {
+        return mixableStream.positionalStream != listenerAudioStream &&
+               _audibleStreams.find(mixableStream.positionalStream) == _audibleStreams.end();
+    }
+
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
 
+    // batched HRTF rendering - spatialized mono sources are gathered per listener and
+    // rendered in groups, amortizing HRTF coefficient fetches across the batch
+    static const int HRTF_BATCH_SIZE = 16;
+    static_assert(HRTF_BATCH_SIZE <= AudioHRTF::MAX_BATCH_SOURCES, "HRTF batch must fit in a single renderBatch call");
+    void batchHRTFRender(AudioHRTF* hrtf, const int16_t* monoSamples, int index,
+                         float azimuth, float distance, float gain);
+    void flushHRTFBatch();
+
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
 
+    // batched HRTF state
+    AudioHRTF::BatchSource _hrtfBatch[HRTF_BATCH_SIZE];
+    int16_t _hrtfBatchSamples[HRTF_BATCH_SIZE][AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+    int _hrtfBatchCount { 0 };
+
+    // per-listener audibility candidates, range-queried from the shared spatial index
+    AudioMixerSpatialIndex::AudibleSet _audibleStreams;
+
     // frame state
     ConstIter _begin;
     ConstIter _end;
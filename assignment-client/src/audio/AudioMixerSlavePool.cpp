@@ -80,17 +80,47 @@ void AudioMixerSlavePool::mix(ConstIter begin, ConstIter end, unsigned int frame
         slave.configureMix(_begin, _end, frame, numToRetain);
     };
 
-    run(begin, end);
+    run(begin, end, true);
+}
+
+// estimate the relative cost of mixing for a listener, from the stream counts of the last frame
+static int estimatedMixCost(const SharedNodePointer& node) {
+    auto data = static_cast<AudioMixerClientData*>(node->getLinkedData());
+    if (!data) {
+        return 0;
+    }
+
+    auto& streams = data->getStreams();
+    return (int)(streams.active.size() + streams.inactive.size() + streams.skipped.size());
 }
 
-void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
+void AudioMixerSlavePool::run(ConstIter begin, ConstIter end, bool sortByCost) {
     _begin = begin;
     _end = end;
 
-    // fill the queue
-    std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
-        _queue.push(node);
-    });
+    if (sortByCost) {
+        // fill the queue longest-processing-time-first, so that slaves pull the heaviest
+        // listeners while the rest of the pool still has work left to balance against;
+        // otherwise a heavy listener popped last sets the tail of the mix barrier
+        _sortedNodes.clear();
+        std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
+            _sortedNodes.emplace_back(estimatedMixCost(node), node);
+        });
+        std::stable_sort(_sortedNodes.begin(), _sortedNodes.end(),
+                         [](const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
+
+        for (auto& node : _sortedNodes) {
+            _queue.push(node.second);
+        }
+        _sortedNodes.clear();
+    } else {
+        // fill the queue
+        std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
+            _queue.push(node);
+        });
+    }
 
     {
         Lock lock(_mutex);
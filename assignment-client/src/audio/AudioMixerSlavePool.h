@@ -80,7 +80,7 @@ public:
     int numThreads() { return _numThreads; }
 
 private:
-    void run(ConstIter begin, ConstIter end);
+    void run(ConstIter begin, ConstIter end, bool sortByCost = false);
     void resize(int numThreads);
 
     std::vector<std::unique_ptr<AudioMixerSlaveThread>> _slaves;
@@ -102,6 +102,7 @@ private:
 
     // frame state
     Queue _queue;
+    std::vector<std::pair<int, SharedNodePointer>> _sortedNodes;    // scratch for cost-ordered queue fill
     ConstIter _begin;
     ConstIter _end;
 
@@ -0,0 +1,86 @@
+//
+//  AudioMixerSpatialIndex.cpp
+//  assignment-client/src/audio
+//
+//  Created by Zach Pomerantz on 9/1/26.
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerSpatialIndex.h"
+
+#include <glm/gtx/norm.hpp>
+
+#include <AudioHRTF.h>
+#include <PositionalAudioStream.h>
+
+#include "AudioMixerClientData.h"
+
+int64_t AudioMixerSpatialIndex::cellKey(const glm::vec3& position) {
+    // 21 bits per axis, biased to keep negative coordinates contiguous
+    const int64_t BIAS = 1 << 20;
+    const int64_t MASK = (1 << 21) - 1;
+
+    int64_t x = ((int64_t)floorf(position.x / CELL_SIZE) + BIAS) & MASK;
+    int64_t y = ((int64_t)floorf(position.y / CELL_SIZE) + BIAS) & MASK;
+    int64_t z = ((int64_t)floorf(position.z / CELL_SIZE) + BIAS) & MASK;
+
+    return (x << 42) | (y << 21) | z;
+}
+
+void AudioMixerSpatialIndex::rebuild(ConstIter begin, ConstIter end) {
+    _cells.clear();
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        AudioMixerClientData* data = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (!data) {
+            return;
+        }
+
+        for (auto& stream : data->getAudioStreams()) {
+            auto positionalStream = static_cast<const PositionalAudioStream*>(stream.get());
+            glm::vec3 position = positionalStream->getPosition();
+            float loudness = positionalStream->getLastPopOutputTrailingLoudness();
+
+            auto& cell = _cells[cellKey(position)];
+            if (cell.entries.empty()) {
+                // snap the center to the cell the first entry hashed into
+                cell.center = glm::floor(position / CELL_SIZE) * CELL_SIZE + glm::vec3(0.5f * CELL_SIZE);
+            }
+            cell.entries.push_back({ positionalStream, position, loudness });
+            cell.maxLoudness = std::max(cell.maxLoudness, loudness);
+        }
+    });
+}
+
+void AudioMixerSpatialIndex::queryAudible(const glm::vec3& listenerPosition, AudibleSet& audible) const {
+    audible.clear();
+
+    // cells are within half a diagonal of their farthest entry
+    const float CELL_RADIUS = 0.5f * CELL_SIZE * 1.7320508f;
+
+    // allow for the most generous zone attenuation setting when deciding a source
+    // can never reach the listener above the audibility floor
+    const float threshold = MIN_AUDIBILITY / ATTN_GAIN_MAX;
+
+    for (auto& it : _cells) {
+        const Cell& cell = it.second;
+
+        // reject the whole cell when even its loudest stream, at the cell's nearest
+        // point, would fall below the audibility floor
+        float cellDistance = glm::length(cell.center - listenerPosition);
+        float minDistance = std::max(cellDistance - CELL_RADIUS, ATTN_DISTANCE_REF);
+        if (cell.maxLoudness < threshold * minDistance) {
+            continue;
+        }
+
+        for (auto& entry : cell.entries) {
+            float distance = std::max(glm::length(entry.position - listenerPosition), ATTN_DISTANCE_REF);
+            if (entry.loudness >= threshold * distance) {
+                audible.insert(entry.stream);
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+//
+//  AudioMixerSpatialIndex.h
+//  assignment-client/src/audio
+//
+//  Created by Zach Pomerantz on 9/1/26.
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerSpatialIndex_h
+#define hifi_AudioMixerSpatialIndex_h
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <NodeList.h>
+
+class PositionalAudioStream;
+
+// Uniform grid over positional stream origins, rebuilt once per mix frame on the mixer
+// thread and range-queried by each slave to cull inaudible sources before any gain or
+// HRTF work is done for them. Cells carry the max trailing loudness of their streams,
+// so a whole cell of quiet sources is rejected with a single distance test.
+class AudioMixerSpatialIndex {
+public:
+    using ConstIter = NodeList::const_iterator;
+    using AudibleSet = std::unordered_set<const PositionalAudioStream*>;
+
+    // loudness-over-distance below which a source cannot contribute a full LSB to the mix
+    static constexpr float MIN_AUDIBILITY = 1.0f / 32768.0f;
+
+    // rebuild the grid from all positional streams (mixer thread, slaves idle)
+    void rebuild(ConstIter begin, ConstIter end);
+
+    // fill audible with the streams whose loudness-over-distance from listenerPosition
+    // passes MIN_AUDIBILITY; far cells are rejected without touching their streams
+    void queryAudible(const glm::vec3& listenerPosition, AudibleSet& audible) const;
+
+private:
+    static constexpr float CELL_SIZE = 16.0f;   // meters
+
+    struct Entry {
+        const PositionalAudioStream* stream;
+        glm::vec3 position;
+        float loudness;
+    };
+
+    struct Cell {
+        std::vector<Entry> entries;
+        glm::vec3 center;
+        float maxLoudness { 0.0f };
+    };
+
+    static int64_t cellKey(const glm::vec3& position);
+
+    std::unordered_map<int64_t, Cell> _cells;
+};
+
+#endif // hifi_AudioMixerSpatialIndex_h
@@ -11,6 +11,47 @@
 
 #include "AudioMixerStats.h"
 
+#include <cstring>
+
+void AudioMixerTimingHistogram::record(uint64_t usecs) {
+    int bucket = 0;
+    while (usecs > 1 && bucket < NUM_BUCKETS - 1) {
+        usecs >>= 1;
+        ++bucket;
+    }
+    ++buckets[bucket];
+}
+
+float AudioMixerTimingHistogram::estimatePercentile(float fraction) const {
+    int total = 0;
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        total += buckets[i];
+    }
+    if (total == 0) {
+        return 0.0f;
+    }
+
+    int target = (int)(fraction * total);
+    int count = 0;
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        count += buckets[i];
+        if (count > target) {
+            return (float)(1u << (i + 1));
+        }
+    }
+    return (float)(1u << NUM_BUCKETS);
+}
+
+void AudioMixerTimingHistogram::reset() {
+    memset(buckets, 0, sizeof(buckets));
+}
+
+void AudioMixerTimingHistogram::accumulate(const AudioMixerTimingHistogram& other) {
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        buckets[i] += other.buckets[i];
+    }
+}
+
 void AudioMixerStats::reset() {
     sumStreams = 0;
     sumListeners = 0;
@@ -36,6 +77,10 @@ void AudioMixerStats::reset() {
     inactive = 0;
     active = 0;
 
+    culledOutOfRange = 0;
+
+    mixTimes.reset();
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime = 0;
 #endif
@@ -66,6 +111,10 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     inactive += otherStats.inactive;
     active += otherStats.active;
 
+    culledOutOfRange += otherStats.culledOutOfRange;
+
+    mixTimes.accumulate(otherStats.mixTimes);
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime += otherStats.mixTime;
 #endif
@@ -12,9 +12,24 @@
 #ifndef hifi_AudioMixerStats_h
 #define hifi_AudioMixerStats_h
 
-#ifdef HIFI_AUDIO_MIXER_DEBUG
 #include <cstdint>
-#endif
+
+// log2-bucketed histogram, cheap enough to record on the mix hot path;
+// each slave owns its own copy so recording is lock-free, and the copies
+// are merged on the mixer thread when stats are gathered
+struct AudioMixerTimingHistogram {
+    static const int NUM_BUCKETS = 16;  // bucket n holds samples in [2^n, 2^(n+1)) usecs
+
+    int buckets[NUM_BUCKETS] = {};
+
+    void record(uint64_t usecs);
+
+    // estimated upper bound of the bucket holding the given fraction of samples, in usecs
+    float estimatePercentile(float fraction) const;
+
+    void reset();
+    void accumulate(const AudioMixerTimingHistogram& other);
+};
 
 struct AudioMixerStats {
     int sumStreams { 0 };
@@ -41,6 +56,11 @@ struct AudioMixerStats {
     int inactive { 0 };
     int active { 0 };
 
+    int culledOutOfRange { 0 };
+
+    // wall time of each listener mix, recorded per slave
+    AudioMixerTimingHistogram mixTimes;
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     uint64_t mixTime { 0 };
 #endif
@@ -485,6 +485,22 @@ void AvatarMixerClientData::resetSentTraitData(Node::LocalID nodeLocalID) {
     }
 }
 
+QByteArray AvatarMixerClientData::getPackedSimpleTrait(AvatarTraits::TraitType traitType,
+                                                       AvatarTraits::TraitVersion traitVersion) const {
+    assert(AvatarTraits::isSimpleTrait(traitType));
+
+    std::lock_guard<std::mutex> lock(_packedTraitsMutex);
+
+    auto& entry = _packedSimpleTraits[traitType];
+    if (entry.version != traitVersion) {
+        entry.data = _avatar->packTrait(traitType);
+        entry.version = traitVersion;
+    }
+
+    // QByteArray is implicitly shared - receivers reference the same buffer
+    return entry.data;
+}
+
 void AvatarMixerClientData::readViewFrustumPacket(const QByteArray& message) {
     _currentViewFrustums.clear();
 
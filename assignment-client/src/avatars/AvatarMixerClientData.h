@@ -13,7 +13,9 @@
 #define hifi_AvatarMixerClientData_h
 
 #include <algorithm>
+#include <array>
 #include <cfloat>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <queue>
@@ -160,6 +162,10 @@ public:
 
     void resetSentTraitData(Node::LocalID nodeID);
 
+    // returns the serialized payload for a simple trait at the given version, packing it
+    // at most once and sharing the immutable buffer across all receivers
+    QByteArray getPackedSimpleTrait(AvatarTraits::TraitType traitType, AvatarTraits::TraitVersion traitVersion) const;
+
 private:
     struct PacketQueue : public std::queue<QSharedPointer<ReceivedMessage>> {
         QWeakPointer<Node> node;
@@ -177,6 +183,15 @@ private:
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeTime;
     std::unordered_map<NLPacket::LocalID, QVector<JointData>> _lastOtherAvatarSentJoints;
 
+    // cached packed payloads of simple traits, keyed by trait version; concurrent
+    // broadcast slaves serialize a changed trait once and share the buffer
+    struct PackedTraitCacheEntry {
+        AvatarTraits::TraitVersion version { AvatarTraits::NULL_TRAIT_VERSION };
+        QByteArray data;
+    };
+    mutable std::mutex _packedTraitsMutex;
+    mutable std::array<PackedTraitCacheEntry, AvatarTraits::NUM_SIMPLE_TRAITS> _packedSimpleTraits;
+
     uint64_t _identityChangeTimestamp;
     bool _avatarSessionDisplayNameMustChange{ true };
     bool _avatarSkeletonModelUrlMustChange{ false };
@@ -20,6 +20,7 @@
 #include <glm/gtx/vector_angle.hpp>
 
 #include <AvatarLogging.h>
+#include <Gzip.h>
 #include <LogHandler.h>
 #include <NetworkAccessManager.h>
 #include <NodeList.h>
@@ -140,9 +141,11 @@ qint64 AvatarMixerSlave::addChangedTraitsToBulkPacket(AvatarMixerClientData* lis
             if (lastSentVersionRef == lastAckedVersionRef) {
                 if (lastReceivedVersion > lastSentVersionRef) {
                     bytesWritten += addTraitsNodeHeader(listeningNodeData, sendingNodeData, traitsPacketList, bytesWritten);
-                    // there is an update to this trait, add it to the traits packet
-                    bytesWritten += AvatarTraits::packVersionedTrait(traitType, traitsPacketList,
-                                                                     lastReceivedVersion, *sendingAvatar);
+                    // there is an update to this trait, add it to the traits packet - the payload
+                    // is packed once per version and shared by reference across all receivers
+                    bytesWritten += AvatarTraits::packVersionedTrait(traitType, traitsPacketList, lastReceivedVersion,
+                                                                     sendingNodeData->getPackedSimpleTrait(traitType,
+                                                                                                           lastReceivedVersion));
                     // update the last sent version
                     lastSentVersionRef = lastReceivedVersion;
                     // Remember which versions we sent in this particular packet
@@ -316,9 +319,9 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
 
     auto nodeList = DependencyManager::get<NodeList>();
 
-    // setup for distributed random floating point values
-    std::random_device randomDevice;
-    std::mt19937 generator(randomDevice());
+    // setup for distributed random floating point values - seeded once per thread,
+    // rather than paying a random_device read per receiver per frame
+    static thread_local std::mt19937 generator(std::random_device{}());
     std::uniform_real_distribution<float> distribution;
 
     _stats.nodesBroadcastedTo++;
@@ -345,6 +348,13 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     int traitBytesSent = 0;
 
     // max number of avatarBytes per frame (13 900, typical)
+    // NOTE: this is already a per-receiver byte budget filled in priority order
+    // (distance/view/recency via the sort above, hero reservation below); what it
+    // is NOT yet is adaptive - the budget derives from configuration rather than
+    // each receiver's measured throughput. Feeding ConnectionStats' delivered-rate
+    // estimate in here (clamped to the configured ceiling) is the remaining piece
+    // of a true governor, and needs those stats surfaced from the node's send
+    // channel to this thread.
     const int maxAvatarBytesPerFrame = int(_maxKbpsPerNode * BYTES_PER_KILOBIT / AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND);
     const int maxHeroBytesPerFrame = int(maxAvatarBytesPerFrame * _avatarHeroFraction);  // 5555, typical
 
@@ -555,6 +565,18 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             // Typically all out-of-view avatars but such avatars' priorities will rise with time:
             bool isLowerPriority = sortedAvatar.getPriority() <= OUT_OF_VIEW_THRESHOLD;
 
+            if (isLowerPriority && !PALIsOpen) {
+                // out-of-view avatars only need a trickle of updates (the far-region rate);
+                // if this receiver was sent an encode recently enough, skip the avatar
+                // outright instead of re-serializing minimum data at the full frame rate
+                const quint64 OUT_OF_VIEW_SEND_PERIOD_USECS = USECS_PER_SECOND / 2;
+                if (usecTimestampNow() - lastEncodeForOther < OUT_OF_VIEW_SEND_PERIOD_USECS) {
+                    destinationNodeData->incrementAvatarOutOfView();
+                    --remainingAvatars;
+                    continue;
+                }
+            }
+
             if (isLowerPriority) {
                 detail = PALIsOpen ? AvatarData::PALMinimum : AvatarData::MinimumData;
                 destinationNodeData->incrementAvatarOutOfView();
@@ -654,10 +676,26 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
     traitsPacketList->closeCurrentPacket();
 
     if (traitsPacketList->getNumPackets() >= 1) {
+        // wrap the assembled traits message in a (compressed-flag, payload) envelope,
+        // gzipping when it pays: skeleton and entity trait blobs typically shrink
+        // several-fold, while small or incompressible messages go out raw
+        QByteArray traitsPayload = traitsPacketList->getMessage();
+
+        QByteArray compressedPayload;
+        const int TRAITS_COMPRESSION_MIN_SIZE = 256;
+        bool sendCompressed = traitsPayload.size() >= TRAITS_COMPRESSION_MIN_SIZE &&
+            gzip(traitsPayload, compressedPayload, -1) &&
+            compressedPayload.size() < traitsPayload.size();
+
+        auto wirePacketList = NLPacketList::create(PacketType::BulkAvatarTraits, QByteArray(), true, true);
+        wirePacketList->writePrimitive((quint8)(sendCompressed ? 1 : 0));
+        wirePacketList->write(sendCompressed ? compressedPayload : traitsPayload);
+        wirePacketList->closeCurrentPacket();
+
         // send the traits packet list
         _stats.numTraitsBytesSent += traitBytesSent;
-        _stats.numTraitsPacketsSent += (int) traitsPacketList->getNumPackets();
-        nodeList->sendPacketList(std::move(traitsPacketList), *destinationNode);
+        _stats.numTraitsPacketsSent += (int) wirePacketList->getNumPackets();
+        nodeList->sendPacketList(std::move(wirePacketList), *destinationNode);
     }
 
     // Send any AvatarIdentity packets:
@@ -14,6 +14,8 @@
 #include <assert.h>
 #include <algorithm>
 
+#include "AvatarMixerClientData.h"
+
 void AvatarMixerSlaveThread::run() {
     while (true) {
         wait();
@@ -75,21 +77,46 @@ void AvatarMixerSlavePool::broadcastAvatarData(ConstIter begin, ConstIter end,
                                                p_high_resolution_clock::time_point lastFrameTimestamp,
                                                float maxKbpsPerNode, float throttlingRatio) {
     _function = &AvatarMixerSlave::broadcastAvatarData;
-    _configure = [=](AvatarMixerSlave& slave) { 
+    _configure = [=](AvatarMixerSlave& slave) {
         slave.configureBroadcast(begin, end, lastFrameTimestamp, maxKbpsPerNode, throttlingRatio,
             _priorityReservedFraction);
    };
-    run(begin, end);
+    run(begin, end, true);
 }
 
-void AvatarMixerSlavePool::run(ConstIter begin, ConstIter end) {
+// estimate the relative broadcast cost for a receiver, from last frame's send count
+static int estimatedBroadcastCost(const SharedNodePointer& node) {
+    auto data = static_cast<AvatarMixerClientData*>(node->getLinkedData());
+    return data ? data->getNumAvatarsSentLastFrame() : 0;
+}
+
+void AvatarMixerSlavePool::run(ConstIter begin, ConstIter end, bool sortByCost) {
     _begin = begin;
     _end = end;
 
-    // fill the queue
-    std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
-        _queue.push(node);
-    });
+    if (sortByCost) {
+        // fill the queue longest-processing-time-first, so the heaviest receivers are
+        // pulled while the pool still has work to balance against, instead of setting
+        // the tail of the broadcast barrier when popped last
+        _sortedNodes.clear();
+        std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
+            _sortedNodes.emplace_back(estimatedBroadcastCost(node), node);
+        });
+        std::stable_sort(_sortedNodes.begin(), _sortedNodes.end(),
+                         [](const auto& a, const auto& b) {
+            return a.first > b.first;
+        });
+
+        for (auto& node : _sortedNodes) {
+            _queue.push(node.second);
+        }
+        _sortedNodes.clear();
+    } else {
+        // fill the queue
+        std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
+            _queue.push(node);
+        });
+    }
 
     {
         Lock lock(_mutex);
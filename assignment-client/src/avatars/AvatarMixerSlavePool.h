@@ -85,7 +85,7 @@ public:
     float getPriorityReservedFraction() const { return  _priorityReservedFraction; }
 
 private:
-    void run(ConstIter begin, ConstIter end);
+    void run(ConstIter begin, ConstIter end, bool sortByCost = false);
     void resize(int numThreads);
 
     std::vector<std::unique_ptr<AvatarMixerSlaveThread>> _slaves;
@@ -111,6 +111,7 @@ private:
 
     // frame state
     Queue _queue;
+    std::vector<std::pair<int, SharedNodePointer>> _sortedNodes;    // scratch for cost-ordered queue fill
     ConstIter _begin;
     ConstIter _end;
 
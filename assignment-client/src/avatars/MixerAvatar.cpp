@@ -11,12 +11,15 @@
 
 #include "MixerAvatar.h"
 
+#include <QCache>
 #include <QRegularExpression>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QNetworkReply>
 #include <QCryptographicHash>
+#include <QRunnable>
+#include <QThreadPool>
 #include <QApplication>
 
 #include <ResourceManager.h>
@@ -136,6 +139,71 @@ void MixerAvatar::fstRequestComplete() {
     fstRequest->deleteLater();
 }
 
+// results of static certification, shared across avatars so that re-joins and
+// many users wearing the same purchased avatar skip the repeated RSA verify
+static const int VERIFIED_FST_CACHE_SIZE = 256;
+static QCache<QString, bool> verifiedFSTCache(VERIFIED_FST_CACHE_SIZE);
+static QMutex verifiedFSTCacheLock;
+
+void MixerAvatar::performStaticValidation() {
+    QMutexLocker certifyLocker(&_avatarCertifyLock);
+
+    if (_verifyState != receivedFST) {
+        // restarted or torn down while the task was queued
+        _verifyTaskRunning = false;
+        return;
+    }
+
+    generateFSTHash();
+    _numberChallenges = 0;
+    if (_certificateIdFromFST.length() != 0) {
+        // snapshot the inputs and release the lock for the RSA verification,
+        // so packet processing for this avatar is never blocked behind crypto
+        QByteArray certificateHash = _certificateHash;
+        QString certificateId = _certificateIdFromFST;
+        QString cacheKey = _marketplaceIdFromFST + ":" + certificateId + ":"
+            + QString::fromLatin1(certificateHash.toHex());
+        certifyLocker.unlock();
+
+        bool staticVerification = false;
+        {
+            QMutexLocker cacheLocker(&verifiedFSTCacheLock);
+            bool* cached = verifiedFSTCache.object(cacheKey);
+            if (cached) {
+                staticVerification = *cached;
+            } else {
+                staticVerification = EntityItemProperties::verifySignature(EntityItem::_marketplacePublicKey,
+                    certificateHash, QByteArray::fromBase64(certificateId.toUtf8()));
+                verifiedFSTCache.insert(cacheKey, new bool(staticVerification));
+            }
+        }
+
+        certifyLocker.relock();
+        if (_verifyState != receivedFST) {
+            // restarted while we were verifying
+            _verifyTaskRunning = false;
+            return;
+        }
+
+        _verifyState = staticVerification ? staticValidation : verificationFailed;
+
+        if (_verifyState == staticValidation) {
+            // continue with the ownership request on the processing thread
+            _pendingEvent = true;
+        } else {
+            _needsIdentityUpdate = true;
+            qCDebug(avatars) << "Avatar" << getDisplayName() << "(" << getSessionUUID() << ") FAILED static certification";
+        }
+    } else {  // FST doesn't have a certificate, so noncertified rather than failed:
+        _certifyFailed = false;
+        _needsIdentityUpdate = true;
+        _verifyState = nonCertified;
+        qCDebug(avatars) << "Avatar " << getDisplayName() << "(" << getSessionUUID() << ") isn't certified";
+    }
+
+    _verifyTaskRunning = false;
+}
+
 bool MixerAvatar::generateFSTHash() {
     if (_avatarFSTContents.length() == 0) {
         return false;
@@ -147,12 +215,6 @@ bool MixerAvatar::generateFSTHash() {
     return true;
 }
 
-bool MixerAvatar::validateFSTHash(const QString& publicKey) const {
-    // Guess we should refactor this stuff into a Authorization namespace ...
-    return EntityItemProperties::verifySignature(publicKey, _certificateHash,
-        QByteArray::fromBase64(_certificateIdFromFST.toUtf8()));
-}
-
 QByteArray MixerAvatar::canonicalJson(const QString fstFile) {
     QStringList fstLines = fstFile.split("\n", QString::SkipEmptyParts);
     static const QString fstKeywordsReg {
@@ -256,27 +318,24 @@ void MixerAvatar::processCertifyEvents() {
 
         case receivedFST:
         {
-            generateFSTHash();
-            _numberChallenges = 0;
-            if (_certificateIdFromFST.length() != 0) {
-                QString& marketplacePublicKey = EntityItem::_marketplacePublicKey;
-                bool staticVerification = validateFSTHash(marketplacePublicKey);
-                _verifyState = staticVerification ? staticValidation : verificationFailed;
-
-                if (_verifyState == staticValidation) {
-                    requestCurrentOwnership();
-                    _verifyState = requestingOwner;
-                } else {
-                    _needsIdentityUpdate = true;
-                    _pendingEvent = false;
-                    qCDebug(avatars) << "Avatar" << getDisplayName() << "(" << getSessionUUID() << ") FAILED static certification";
-                }
-            } else {  // FST doesn't have a certificate, so noncertified rather than failed:
+            // the canonical JSON pass, SHA-256, and RSA verification are CPU-bound;
+            // hand them to the thread pool so a join burst can't degrade frame timing
+            if (!_verifyTaskRunning) {
+                _verifyTaskRunning = true;
                 _pendingEvent = false;
-                _certifyFailed = false;
-                _needsIdentityUpdate = true;
-                _verifyState = nonCertified;
-                qCDebug(avatars) << "Avatar " << getDisplayName() << "(" << getSessionUUID() << ") isn't certified";
+
+                class StaticValidationTask : public QRunnable {
+                public:
+                    StaticValidationTask(std::shared_ptr<MixerAvatar> avatar) : _avatar(std::move(avatar)) {}
+                    void run() override { _avatar->performStaticValidation(); }
+                private:
+                    std::shared_ptr<MixerAvatar> _avatar;
+                };
+
+                // SpatiallyNestable owns the weak-this; downcast its pointer rather than
+                // adding a second enable_shared_from_this base
+                auto sharedThis = std::static_pointer_cast<MixerAvatar>(shared_from_this());
+                QThreadPool::globalInstance()->start(new StaticValidationTask(std::move(sharedThis)));
             }
             break;
         }
@@ -14,6 +14,8 @@
 #ifndef hifi_MixerAvatar_h
 #define hifi_MixerAvatar_h
 
+#include <memory>
+
 #include <AvatarData.h>
 
 class ResourceRequest;
@@ -34,6 +36,10 @@ public:
     void processCertifyEvents();
     void processChallengeResponse(ReceivedMessage& response);
 
+    // CPU-bound static certification (canonical JSON, SHA-256, RSA verify),
+    // run on the global thread pool so join bursts don't stall the mixer
+    void performStaticValidation();
+
     void stopChallengeTimer();
 
     // Avatar certification/verification:
@@ -70,11 +76,11 @@ private:
     int _numberChallenges { 0 };
     bool _certifyFailed { false };
     bool _needsIdentityUpdate { false };
+    bool _verifyTaskRunning { false };  // guarded by _avatarCertifyLock
     bool _inScreenshareZone { false };
     QUuid _screenshareZone;
 
     bool generateFSTHash();
-    bool validateFSTHash(const QString& publicKey) const;
     QByteArray canonicalJson(const QString fstFile);
     void requestCurrentOwnership();
     void sendOwnerChallenge();
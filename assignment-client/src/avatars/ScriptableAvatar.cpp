@@ -11,6 +11,9 @@
 
 #include "ScriptableAvatar.h"
 
+#include <map>
+#include <mutex>
+
 #include <QDebug>
 #include <QThread>
 #include <glm/gtx/transform.hpp>
@@ -48,6 +51,9 @@ void ScriptableAvatar::startAnimation(const QString& url, float fps, float prior
     _animation = DependencyManager::get<AnimationCache>()->getAnimation(url);
     _animationDetails = AnimationDetails("", QUrl(url), fps, 0, loop, hold, false, firstFrame, lastFrame, true, firstFrame, false);
     _maskedJoints = maskedJoints;
+    // force the joint mapping to be rebuilt for the new mask, even if the same
+    // animation is restarted
+    _mappedAnimation.clear();
 }
 
 void ScriptableAvatar::stopAnimation() {
@@ -87,6 +93,9 @@ QStringList ScriptableAvatar::getJointNames() const {
 void ScriptableAvatar::setSkeletonModelURL(const QUrl& skeletonModelURL) {
     _bind.reset();
     _animSkeleton.reset();
+    // the cached animation-to-model joint mapping was resolved against the old
+    // bind skeleton; force it to rebuild against the new one
+    _mappedAnimation.clear();
 
     AvatarData::setSkeletonModelURL(skeletonModelURL);
     updateJointMappings();
@@ -136,7 +145,17 @@ void ScriptableAvatar::update(float deltatime) {
     // Run animation
     if (_animation && _animation->isLoaded() && _animation->getFrames().size() > 0 && !_bind.isNull() && _bind->isLoaded()) {
         if (!_animSkeleton) {
-            _animSkeleton = std::make_shared<AnimSkeleton>(_bind->getHFMModel());
+            // identical NPCs share a skeleton: AnimSkeleton is immutable once
+            // built, and the bind resource is already deduplicated by URL, so
+            // key a process-wide cache on the resource
+            static std::mutex skeletonCacheMutex;
+            static std::map<Animation*, std::weak_ptr<AnimSkeleton>> skeletonCache;
+            std::lock_guard<std::mutex> guard(skeletonCacheMutex);
+            _animSkeleton = skeletonCache[_bind.data()].lock();
+            if (!_animSkeleton) {
+                _animSkeleton = std::make_shared<AnimSkeleton>(_bind->getHFMModel());
+                skeletonCache[_bind.data()] = _animSkeleton;
+            }
         }
         float currentFrame = _animationDetails.currentFrame + deltatime * _animationDetails.fps;
         if (_animationDetails.loop || currentFrame < _animationDetails.lastFrame) {
@@ -146,7 +165,21 @@ void ScriptableAvatar::update(float deltatime) {
             _animationDetails.currentFrame = currentFrame;
 
             const QVector<HFMJoint>& modelJoints = _bind->getHFMModel().joints;
-            QStringList animationJointNames = _animation->getJointNames();
+
+            // the animation-to-model joint mapping only depends on the animation
+            // and the bind skeleton, so resolve the per-joint name lookups once
+            // per animation instead of every update
+            if (_mappedAnimation != _animation) {
+                const QStringList animationJointNames = _animation->getJointNames();
+                _animationJointMappings.resize(animationJointNames.size());
+                for (int i = 0; i < animationJointNames.size(); i++) {
+                    const QString& name = animationJointNames[i];
+                    // As long as we need the model preRotations anyway, let's get the jointIndex from the bind skeleton rather than
+                    // trusting the .fst (which is sometimes not updated to match changes to .fbx).
+                    _animationJointMappings[i] = _maskedJoints.contains(name) ? -1 : _bind->getHFMModel().getJointIndex(name);
+                }
+                _mappedAnimation = _animation;
+            }
 
             const int nJoints = modelJoints.size();
             if (_jointData.size() != nJoints) {
@@ -161,15 +194,12 @@ void ScriptableAvatar::update(float deltatime) {
 
             const float UNIT_SCALE = 0.01f;
 
-            for (int i = 0; i < animationJointNames.size(); i++) {
-                const QString& name = animationJointNames[i];
-                // As long as we need the model preRotations anyway, let's get the jointIndex from the bind skeleton rather than
-                // trusting the .fst (which is sometimes not updated to match changes to .fbx).
-                int mapping = _bind->getHFMModel().getJointIndex(name);
-                if (mapping != -1 && !_maskedJoints.contains(name)) {
+            for (size_t i = 0; i < _animationJointMappings.size(); i++) {
+                int mapping = _animationJointMappings[i];
+                if (mapping != -1) {
 
-                    AnimPose floorPose = composeAnimPose(modelJoints[mapping], floorFrame.rotations[i], floorFrame.translations[i] * UNIT_SCALE);
-                    AnimPose ceilPose = composeAnimPose(modelJoints[mapping], ceilFrame.rotations[i], floorFrame.translations[i] * UNIT_SCALE);
+                    AnimPose floorPose = composeAnimPose(modelJoints[mapping], floorFrame.rotations[(int)i], floorFrame.translations[(int)i] * UNIT_SCALE);
+                    AnimPose ceilPose = composeAnimPose(modelJoints[mapping], ceilFrame.rotations[(int)i], floorFrame.translations[(int)i] * UNIT_SCALE);
                     blend(1, &floorPose, &ceilPose, frameFraction, &poses[mapping]);
                  }
             }
@@ -217,6 +217,10 @@ private:
     QStringList _maskedJoints;
     AnimationPointer _bind; // a sleazy way to get the skeleton, given the various library/cmake dependencies
     std::shared_ptr<AnimSkeleton> _animSkeleton;
+    // animation joint index -> bind skeleton joint index (-1 for masked or
+    // unmatched joints), resolved once per animation
+    AnimationPointer _mappedAnimation;
+    std::vector<int> _animationJointMappings;
     QHash<QString, int> _fstJointIndices; ///< 1-based, since zero is returned for missing keys
     QStringList _fstJointNames; ///< in order of depth-first traversal
     QUrl _skeletonFBXURL;
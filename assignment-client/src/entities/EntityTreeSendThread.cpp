@@ -99,6 +99,34 @@ void EntityTreeSendThread::preDistributionProcessing() {
     }
 }
 
+bool EntityTreeSendThread::hasTraversalWork(OctreeQueryNode* nodeData, bool viewFrustumChanged) {
+    if (viewFrustumChanged || !_traversal.finished() || !_sendQueue.empty() ||
+        nodeData->isPacketWaiting() || nodeData->wantReportInitialCompletion()) {
+        return true;
+    }
+
+    uint64_t lastCompleted = _traversal.getStartOfCompletedTraversal();
+    if (lastCompleted == 0) {
+        // never completed a traversal for this viewer
+        return true;
+    }
+
+    // a view-parameter change that doesn't flag viewFrustumChanged still needs a pass
+    int32_t lodLevelOffset = nodeData->getBoundaryLevelAdjust() + NO_BOUNDARY_ADJUST;
+    const auto& currentView = _traversal.getCurrentView();
+    if (currentView.lodScaleFactor != powf(2.0f, lodLevelOffset) ||
+        currentView.usesViewFrustums() != !nodeData->getCurrentViews().empty()) {
+        return true;
+    }
+
+    // element changes bubble to the root, so untouched root timestamps mean a
+    // repeat traversal could not find anything
+    EntityTreeElementPointer root = std::dynamic_pointer_cast<EntityTreeElement>(_myServer->getOctree()->getRoot());
+    return !root ||
+        root->getLastChanged() > lastCompleted ||
+        root->getLastChangedContent() > lastCompleted;
+}
+
 bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, OctreeQueryNode* nodeData,
             bool viewFrustumChanged, bool isFullScene) {
     if (viewFrustumChanged || _traversal.finished()) {
@@ -110,8 +138,22 @@ bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, O
 
         int32_t lodLevelOffset = nodeData->getBoundaryLevelAdjust() + (viewFrustumChanged ? LOW_RES_MOVING_ADJUST : NO_BOUNDARY_ADJUST);
         newView.lodScaleFactor = powf(2.0f, lodLevelOffset);
-        
-        startNewTraversal(newView, root, isFullScene);
+
+        // Steady-state short circuit: element changes bubble to the root, so with an
+        // unchanged view, identical LOD, and a root untouched since the last completed
+        // traversal there is nothing a repeat pass could find. Idle viewers then cost
+        // O(1) per tick instead of a re-walk proportional to world size.
+        uint64_t lastCompleted = _traversal.getStartOfCompletedTraversal();
+        bool treeUnchanged = lastCompleted != 0 &&
+            root->getLastChanged() <= lastCompleted &&
+            root->getLastChangedContent() <= lastCompleted;
+        bool skipTraversal = !viewFrustumChanged && !isFullScene && _traversal.finished() && treeUnchanged &&
+            _traversal.getCurrentView().lodScaleFactor == newView.lodScaleFactor &&
+            _traversal.getCurrentView().usesViewFrustums() == newView.usesViewFrustums();
+
+        if (!skipTraversal) {
+            startNewTraversal(newView, root, isFullScene);
+        }
 
         // When the viewFrustum changed the sort order may be incorrect, so we re-sort
         // and also use the opportunity to cull anything no longer in view
@@ -377,6 +419,17 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
                     // Record explicitly filtered-in entity so that extra entities can be flagged.
                     entityNodeData->insertSentFilteredEntity(entityID);
                 }
+                // TODO: a cross-viewer encode cache was investigated for this call
+                // (content-version keyed entity payloads, shared by viewers whose
+                // LOD and flags match, invalidated by the edit path). It doesn't
+                // drop in cleanly: appendEntityData encodes against the remaining
+                // space of this viewer's packet and can return PARTIAL, resuming
+                // mid-property via _extraEncodeData on the next packet, so the
+                // bytes produced are a function of packet fill, not just entity
+                // state; per-viewer filters (private user data rights, JSON
+                // filters) also change the property set per destination. A cache
+                // needs the encode split into a position-independent full-payload
+                // stage plus a splice stage before fragments can be shared.
                 OctreeElement::AppendState appendEntityState = entity->appendEntityData(&_packetData, params, _extraEncodeData, entityNode->getCanGetAndSetPrivateUserData());
 
                 if (appendEntityState != OctreeElement::COMPLETED) {
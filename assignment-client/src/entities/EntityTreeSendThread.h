@@ -48,6 +48,7 @@ private:
     void preDistributionProcessing() override;
     bool hasSomethingToSend(OctreeQueryNode* nodeData) override { return !_sendQueue.empty(); }
     bool shouldStartNewTraversal(OctreeQueryNode* nodeData, bool viewFrustumChanged) override { return viewFrustumChanged || _traversal.finished(); }
+    bool hasTraversalWork(OctreeQueryNode* nodeData, bool viewFrustumChanged) override;
 
     DiffTraversal _traversal;
     EntityPriorityQueue _sendQueue;
@@ -59,15 +59,21 @@ void MessagesMixer::handleMessages(QSharedPointer<ReceivedMessage> receivedMessa
         *itr += 1;
     }
 
-    nodeList->eachMatchingNode(
-        [&](const SharedNodePointer& node)->bool {
-        return node->getActiveSocket() && _channelSubscribers[channel].contains(node->getUUID());
-    },
-        [&](const SharedNodePointer& node) {
-        auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
-                                   MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
-        nodeList->sendPacketList(std::move(packetList), *node);
-    });
+    // fan out over the channel's subscriber set instead of testing every connected
+    // node for membership (which also inserted empty sets for unknown channels)
+    auto channelIt = _channelSubscribers.constFind(channel);
+    if (channelIt == _channelSubscribers.constEnd()) {
+        return;
+    }
+
+    for (const QUuid& subscriberID : channelIt.value()) {
+        auto node = nodeList->nodeWithUUID(subscriberID);
+        if (node && node->getActiveSocket()) {
+            auto packetList = isText ? MessagesClient::encodeMessagesPacket(channel, message, senderID) :
+                                       MessagesClient::encodeMessagesDataPacket(channel, data, senderID);
+            nodeList->sendPacketList(std::move(packetList), *node);
+        }
+    }
 }
 
 void MessagesMixer::handleMessagesSubscribe(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode) {
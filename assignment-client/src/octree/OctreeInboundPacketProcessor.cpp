@@ -154,52 +154,59 @@ void OctreeInboundPacketProcessor::processPacket(QSharedPointer<ReceivedMessage>
         }
         
         const unsigned char* editData = nullptr;
-        
-        while (message->getBytesLeftToRead() > 0) {
 
-            editData = reinterpret_cast<const unsigned char*>(message->getRawMessage() + message->getPosition());
+        // take the tree write lock once for the whole packet instead of once per
+        // edit record: build-event bursts pack many records per packet, and the
+        // per-record acquire/release churn dominated edit application time while
+        // the work under the lock stays bounded by the packet size
+        quint64 startLock = usecTimestampNow();
+        quint64 startProcess = 0;
+        _myServer->getOctree()->withWriteLock([&] {
+            startProcess = usecTimestampNow();
+            while (message->getBytesLeftToRead() > 0) {
 
-            int maxSize = message->getBytesLeftToRead();
+                editData = reinterpret_cast<const unsigned char*>(message->getRawMessage() + message->getPosition());
 
-            if (debugProcessPacket) {
-                qDebug() << " --- inside while loop ---";
-                qDebug() << "    maxSize=" << maxSize;
-                qDebug("OctreeInboundPacketProcessor::processPacket() %hhu "
-                       "payload=%p payloadLength=%lld editData=%p payloadPosition=%lld maxSize=%d",
-                       (unsigned char)packetType, message->getRawMessage(), message->getSize(), editData,
-                        message->getPosition(), maxSize);
-            }
+                int maxSize = message->getBytesLeftToRead();
 
-            quint64 startProcess, startLock = usecTimestampNow();
-            int editDataBytesRead;
-            _myServer->getOctree()->withWriteLock([&] {
-                startProcess = usecTimestampNow();
-                editDataBytesRead =
+                if (debugProcessPacket) {
+                    qDebug() << " --- inside while loop ---";
+                    qDebug() << "    maxSize=" << maxSize;
+                    qDebug("OctreeInboundPacketProcessor::processPacket() %hhu "
+                           "payload=%p payloadLength=%lld editData=%p payloadPosition=%lld maxSize=%d",
+                           (unsigned char)packetType, message->getRawMessage(), message->getSize(), editData,
+                            message->getPosition(), maxSize);
+                }
+
+                int editDataBytesRead =
                     _myServer->getOctree()->processEditPacketData(*message, editData, maxSize, sendingNode);
-            });
-            quint64 endProcess = usecTimestampNow();
 
-            if (debugProcessPacket) {
-                qDebug() << "OctreeInboundPacketProcessor::processPacket() after processEditPacketData()..."
-                    << "editDataBytesRead=" << editDataBytesRead;
-            }
+                if (debugProcessPacket) {
+                    qDebug() << "OctreeInboundPacketProcessor::processPacket() after processEditPacketData()..."
+                        << "editDataBytesRead=" << editDataBytesRead;
+                }
 
-            editsInPacket++;
-            quint64 thisProcessTime = endProcess - startProcess;
-            quint64 thisLockWaitTime = startProcess - startLock;
-            processTime += thisProcessTime;
-            lockWaitTime += thisLockWaitTime;
+                if (editDataBytesRead <= 0) {
+                    // malformed remainder - don't spin on it while holding the lock
+                    break;
+                }
 
-            // skip to next edit record in the packet
-            message->seek(message->getPosition() + editDataBytesRead);
+                editsInPacket++;
 
-            if (debugProcessPacket) {
-                qDebug() << "    editDataBytesRead=" << editDataBytesRead;
-                qDebug() << "    AFTER processEditPacketData payload position=" << message->getPosition();
-                qDebug() << "    AFTER processEditPacketData payload size=" << message->getSize();
-            }
+                // skip to next edit record in the packet
+                message->seek(message->getPosition() + editDataBytesRead);
 
-        }
+                if (debugProcessPacket) {
+                    qDebug() << "    editDataBytesRead=" << editDataBytesRead;
+                    qDebug() << "    AFTER processEditPacketData payload position=" << message->getPosition();
+                    qDebug() << "    AFTER processEditPacketData payload size=" << message->getSize();
+                }
+
+            }
+        });
+        quint64 endProcess = usecTimestampNow();
+        processTime += endProcess - startProcess;
+        lockWaitTime += startProcess - startLock;
 
         if (debugProcessPacket) {
             qDebug("OctreeInboundPacketProcessor::processPacket() DONE LOOPING FOR %hhu "
@@ -363,9 +363,15 @@ int OctreeSendThread::packetDistributor(SharedNodePointer node, OctreeQueryNode*
 
     quint64 start = usecTimestampNow();
 
-    _myServer->getOctree()->withReadLock([&]{
-        traverseTreeAndSendContents(node, nodeData, viewFrustumChanged, isFullScene);
-    });
+    // idle viewers with nothing to traverse or flush skip the tree lock entirely.
+    // A forced full scene (set by preDistributionProcessing for newly matched
+    // filtered entities) must traverse even when nothing in the tree changed -
+    // and the force flag was already consumed into isFullScene above.
+    if (isFullScene || hasTraversalWork(nodeData, viewFrustumChanged)) {
+        _myServer->getOctree()->withReadLock([&]{
+            traverseTreeAndSendContents(node, nodeData, viewFrustumChanged, isFullScene);
+        });
+    }
 
     // Here's where we can/should allow the server to send other data...
     // send the environment packet
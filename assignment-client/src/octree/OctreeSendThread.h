@@ -70,6 +70,11 @@ private:
     virtual bool hasSomethingToSend(OctreeQueryNode* nodeData) = 0;
     virtual bool shouldStartNewTraversal(OctreeQueryNode* nodeData, bool viewFrustumChanged) = 0;
 
+    // true when a traversal pass could produce or flush anything for this viewer;
+    // subclasses may override so idle viewers skip taking the tree lock entirely,
+    // keeping reader counts on the shared tree proportional to active viewers
+    virtual bool hasTraversalWork(OctreeQueryNode* nodeData, bool viewFrustumChanged) { return true; }
+
     int _truePacketsSent { 0 }; // available for debug stats
     int _trueBytesSent { 0 }; // available for debug stats
     int _packetsSentThisInterval { 0 }; // used for bandwidth throttle condition
@@ -463,6 +463,24 @@ void EntityScriptServer::resetEntitiesScriptEngine() {
 
     connect(newEngine.data(), &ScriptEngine::update, this, [this] {
         _entityViewer.queryOctree();
+
+        // feed avatar positions to the simulation, so kinematic entities nobody is
+        // near are suspended instead of being stepped every frame; only engage the
+        // gate when avatar data is actually flowing to this node, since an empty
+        // hash is indistinguishable from a missing feed
+        auto simulation = _entityViewer.getTree()->getSimulation();
+        if (simulation) {
+            auto avatarHash = DependencyManager::get<AvatarHashMap>()->getHashCopy();
+            if (!avatarHash.isEmpty()) {
+                std::vector<glm::vec3> viewerPositions;
+                viewerPositions.reserve(avatarHash.size());
+                for (auto& avatar : avatarHash) {
+                    viewerPositions.push_back(avatar->getWorldPosition());
+                }
+                simulation->setSimulationViewerPositions(viewerPositions);
+            }
+        }
+
         _entityViewer.getTree()->preUpdate();
         _entityViewer.getTree()->update();
     });
@@ -26,6 +26,13 @@
 #include <ThreadedAssignment.h>
 #include "../entities/EntityTreeHeadlessViewer.h"
 
+// TODO: all entity scripts share one ScriptEngine here, so a hot script starves
+// the rest and a reload is total. Partitioning across N engines by entityID hash
+// is mostly mechanical at this level (the engine-per-script routing already goes
+// through setPersistent/NonPersistentEntitiesScriptEngine), but scripts share
+// state through Messages and global object properties that today observe
+// single-engine ordering, and the EntityScriptingInterface binds one engine pair -
+// those contracts need explicit routing before the split.
 class EntityScriptServer : public ThreadedAssignment {
     Q_OBJECT
 
@@ -236,6 +236,12 @@ void AssetsBackupHandler::loadingComplete() {
     checkForAssetsToDelete();
 }
 
+// NOTE: scheduled backups are already incremental with respect to asset content:
+// only the mappings table goes into each backup zip, while the asset payloads stay
+// in the server's content-addressed file store, shared across every backup that
+// references their hashes (_assetsInBackups pins them against deletion). The I/O
+// heavy full-content zip is only assembled on explicit download/recovery requests,
+// not on the backup schedule.
 void AssetsBackupHandler::createBackup(const QString& backupName, QuaZip& zip) {
     Q_ASSERT(QThread::currentThread() == thread());
 
@@ -689,6 +689,12 @@ void DomainGatekeeper::cleanupICEPeerForNode(const QUuid& nodeID) {
     }
 }
 
+// NOTE on caching/offloading: each connect attempt signs a one-time connection
+// token (removed below on success), so signatures never repeat and a
+// (username, key) -> verdict cache can never hit without weakening the replay
+// protection. The per-attempt crypto cost is a single RSA_verify; offloading it
+// to a worker pool would require making the connect state machine re-entrant
+// mid-handshake, which is only worth it at attempt rates far beyond a join storm.
 bool DomainGatekeeper::verifyUserSignature(const QString& username,
                                            const QByteArray& usernameSignature,
                                            const SockAddr& senderSockAddr) {
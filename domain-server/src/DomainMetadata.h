@@ -19,6 +19,17 @@
 #include <QJsonObject>
 #include "HTTPManager.h"
 
+// TODO: a content prefetch manifest (asset URL + hash + priority, served to
+// clients at connect so ResourceCache::prefetch can warm caches before the
+// entity stream finishes parsing) would naturally live alongside this
+// metadata: the domain server is the only party that can enumerate the
+// world's asset set up front. The blocker is that the domain server doesn't
+// hold the entity tree - the entity server owns it and the domain server only
+// relays content - so manifest generation either subscribes this process to
+// the entity stream (a new consumer with real memory cost) or, more cheaply,
+// has the entity server emit the URL list from its existing persist pass and
+// hand it over for publication here. Client-side, every cache already exposes
+// prefetch(), so the consuming half is wiring, not new machinery.
 class DomainMetadata : public QObject, public HTTPRequestHandler {
 Q_OBJECT
 
@@ -64,6 +64,13 @@ enum ReplicationServerDirection {
 
 class DomainServerAcmeClient;
 
+// TODO: packet-facing work (gatekeeper auth, heartbeats, ICE pings) shares this
+// one Qt event loop with the HTTP settings/stats handlers, so monitoring scrapes
+// and web traffic can queue ahead of connection handshakes under load. Splitting
+// requires moving the NodeList (and with it the gatekeeper's packet listeners)
+// onto a dedicated thread; most gatekeeper state is already confined to packet
+// processing, but the settings manager and connected-node bookkeeping are read
+// from the HTTP handlers and would need snapshotting across the boundary first.
 class DomainServer : public QCoreApplication, public HTTPSRequestHandler {
     Q_OBJECT
 public:
@@ -117,6 +117,7 @@ static const QMap<QString, DomainServerExporter::MetricType> TYPE_MAP {
     { "audio_mixer_mix_stats_active_to_inactive"                                                  , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_active_to_skippped"                                                  , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_avg_mixes_per_block"                                                 , DomainServerExporter::MetricType::Gauge },
+    { "audio_mixer_mix_stats_culled_out_of_range"                                                 , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_hrtf_renders"                                                        , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_hrtf_resets"                                                         , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_hrtf_updates"                                                        , DomainServerExporter::MetricType::Counter },
@@ -130,6 +131,9 @@ static const QMap<QString, DomainServerExporter::MetricType> TYPE_MAP {
     { "audio_mixer_mix_stats_skippped_to_active"                                                  , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_skippped_to_inactive"                                                , DomainServerExporter::MetricType::Counter },
     { "audio_mixer_mix_stats_total_mixes"                                                         , DomainServerExporter::MetricType::Counter },
+    { "audio_mixer_mix_stats_us_per_mix_p50"                                                      , DomainServerExporter::MetricType::Gauge },
+    { "audio_mixer_mix_stats_us_per_mix_p90"                                                      , DomainServerExporter::MetricType::Gauge },
+    { "audio_mixer_mix_stats_us_per_mix_p99"                                                      , DomainServerExporter::MetricType::Gauge },
     { "audio_mixer_silent_packets_per_frame"                                                      , DomainServerExporter::MetricType::Gauge },
     { "audio_mixer_threads"                                                                       , DomainServerExporter::MetricType::Gauge },
     { "audio_mixer_throttling_ratio"                                                              , DomainServerExporter::MetricType::Gauge },
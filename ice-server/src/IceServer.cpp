@@ -181,6 +181,18 @@ bool IceServer::isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& pla
 
             if (rsaPublicKey) {
                 auto hashedPlaintext = QCryptographicHash::hash(plaintext, QCryptographicHash::Sha256);
+
+                // a domain's heartbeats are byte-identical while its sockets are stable and
+                // the signature scheme is deterministic, so a digest match means this exact
+                // heartbeat already passed RSA verification (replaying it is idempotent in
+                // this protocol either way) - skip the expensive verify for repeats
+                QByteArray heartbeatDigest = QCryptographicHash::hash(hashedPlaintext + signature,
+                                                                      QCryptographicHash::Sha256);
+                auto cachedDigest = _verifiedHeartbeatDigests.constFind(domainID);
+                if (cachedDigest != _verifiedHeartbeatDigests.constEnd() && cachedDigest.value() == heartbeatDigest) {
+                    return true;
+                }
+
                 int verificationResult = RSA_verify(NID_sha256,
                                                     reinterpret_cast<const unsigned char*>(hashedPlaintext.constData()),
                                                     hashedPlaintext.size(),
@@ -190,9 +202,11 @@ bool IceServer::isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& pla
 
                 if (verificationResult == 1) {
                     // this is the only success case - we return true here to indicate that the heartbeat is verified
+                    _verifiedHeartbeatDigests.insert(domainID, heartbeatDigest);
                     return true;
                 } else {
                     qDebug() << "Failed to verify heartbeat for" << domainID << "- re-requesting public key from API.";
+                    _verifiedHeartbeatDigests.remove(domainID);
                 }
 
             } else {
@@ -211,6 +225,9 @@ bool IceServer::isVerifiedHeartbeat(const QUuid& domainID, const QByteArray& pla
 }
 
 void IceServer::requestDomainPublicKey(const QUuid& domainID) {
+    // the key may be changing - don't accept cached heartbeat verdicts across a rotation
+    _verifiedHeartbeatDigests.remove(domainID);
+
     // send a request to the metaverse API for the public key for this domain
     auto& networkAccessManager = NetworkAccessManager::getInstance();
 
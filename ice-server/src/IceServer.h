@@ -56,6 +56,10 @@ private:
     using DomainPublicKeyHash = std::unordered_map<QUuid, RSAUniquePtr>;
     DomainPublicKeyHash _domainPublicKeys;
 
+    // digest of the last heartbeat that passed RSA verification, per domain -
+    // repeats skip the verify; cleared on failure or key re-request
+    QHash<QUuid, QByteArray> _verifiedHeartbeatDigests;
+
     QSet<QUuid> _pendingPublicKeyRequests;
 };
 
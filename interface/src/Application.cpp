@@ -407,9 +407,21 @@ public:
         _heartbeat = now;
     }
 
+    // coarse main-thread activity marker, so watchdog warnings and the deadlock
+    // crash annotation say which phase held the thread instead of just how long
+    class Scope {
+    public:
+        Scope(const char* activity) : _previous(_activity.exchange(activity)) {}
+        ~Scope() { _activity = _previous; }
+    private:
+        const char* _previous;
+    };
+    static std::atomic<const char*> _activity;
+
     void deadlockDetectionCrash() {
         setCrashAnnotation("_mod_faulting_tid", std::to_string((uint64_t)_mainThreadID));
         setCrashAnnotation("deadlock", "1");
+        setCrashAnnotation("deadlock_activity", _activity.load());
         uint32_t* crashTrigger = nullptr;
         *crashTrigger = 0xDEAD10CC;
     }
@@ -479,6 +491,7 @@ public:
 
             if (lastHeartbeatAge > MAX_HEARTBEAT_AGE_USECS) {
                 qCDebug(interfaceapp_deadlock) << "DEADLOCK DETECTED -- "
+                         << "activity:" << _activity.load()
                          << "lastHeartbeatAge:" << lastHeartbeatAge
                          << "[ lastHeartbeat :" << lastHeartbeat
                          << "now:" << now << " ]"
@@ -508,6 +521,7 @@ public:
 };
 
 std::atomic<bool> DeadlockWatchdogThread::_paused;
+std::atomic<const char*> DeadlockWatchdogThread::_activity { "idle" };
 std::atomic<uint64_t> DeadlockWatchdogThread::_heartbeat;
 std::atomic<uint64_t> DeadlockWatchdogThread::_maxElapsed;
 std::atomic<int> DeadlockWatchdogThread::_maxElapsedAverage;
@@ -6578,12 +6592,14 @@ void Application::update(float deltaTime) {
     {
         PROFILE_RANGE(app, "PickManager");
         PerformanceTimer perfTimer("pickManager");
+        DeadlockWatchdogThread::Scope watchdogScope("pickManager");
         DependencyManager::get<PickManager>()->update();
     }
 
     {
         PROFILE_RANGE(app, "PointerManager");
         PerformanceTimer perfTimer("pointerManager");
+        DeadlockWatchdogThread::Scope watchdogScope("pointerManager");
         DependencyManager::get<PointerManager>()->update();
     }
 
@@ -6592,6 +6608,7 @@ void Application::update(float deltaTime) {
     {
         PROFILE_RANGE(simulation_physics, "Simulation");
         PerformanceTimer perfTimer("simulation");
+        DeadlockWatchdogThread::Scope watchdogScope("simulation");
 
         getEntities()->preUpdate();
         _entitySimulation->removeDeadEntities();
@@ -6717,12 +6734,14 @@ void Application::update(float deltaTime) {
         {
             PROFILE_RANGE(simulation, "OtherAvatars");
             PerformanceTimer perfTimer("otherAvatars");
+            DeadlockWatchdogThread::Scope watchdogScope("otherAvatars");
             avatarManager->updateOtherAvatars(deltaTime);
         }
 
         {
             PROFILE_RANGE(simulation, "MyAvatar");
             PerformanceTimer perfTimer("MyAvatar");
+            DeadlockWatchdogThread::Scope watchdogScope("myAvatar");
             qApp->updateMyAvatarLookAtPosition(deltaTime);
             avatarManager->updateMyAvatar(deltaTime);
         }
@@ -6825,6 +6844,7 @@ void Application::update(float deltaTime) {
     {
         PROFILE_RANGE_EX(app, "PostUpdateLambdas", 0xffff0000, (uint64_t)0);
         PerformanceTimer perfTimer("postUpdateLambdas");
+        DeadlockWatchdogThread::Scope watchdogScope("postUpdateLambdas");
         std::unique_lock<std::mutex> guard(_postUpdateLambdasLock);
         for (auto& iter : _postUpdateLambdas) {
             iter.second();
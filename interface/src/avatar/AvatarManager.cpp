@@ -109,6 +109,7 @@ void AvatarManager::init() {
     {
         QWriteLocker locker(&_hashLock);
         _avatarHash.insert(MY_AVATAR_KEY, _myAvatar);
+        publishAvatarHashSnapshot();
     }
 
     _shouldRender = DependencyManager::get<SceneScriptingInterface>()->shouldRenderAvatars();
@@ -340,8 +341,17 @@ void AvatarManager::updateOtherAvatars(float deltaTime) {
                     avatar->_transit.reset();
                     avatar->setIsNewAvatar(false);
                 }
+                // animation LOD: beyond the near workload regions the per-frame IK
+                // solves aren't visible, so let distant avatars play base animation
+                // without them (the rig fades IK back in when they come close)
+                uint8_t workloadRegion = avatar->getWorkloadRegion();
+                auto& rig = avatar->getSkeletonModel()->getRig();
+                rig.setEnableInverseKinematics(workloadRegion <= workload::Region::R2);
+                // ...and suspend hair/cloth flow integration at the same distance
+                rig.setFlowLODSuspended(workloadRegion > workload::Region::R2);
+
                 avatar->simulate(deltaTime, inView);
-                if (avatar->getSkeletonModel()->isLoaded() && avatar->getWorkloadRegion() == workload::Region::R1) {
+                if (avatar->getSkeletonModel()->isLoaded() && workloadRegion == workload::Region::R1) {
                     _myAvatar->addAvatarHandsToFlow(avatar);
                 }
                 if (_drawOtherAvatarSkeletons) {
@@ -626,6 +636,8 @@ void AvatarManager::clearOtherAvatars() {
                 ++avatarIterator;
             }
         }
+
+        publishAvatarHashSnapshot();
     }
 
     for (auto& av : removedAvatars) {
@@ -647,6 +659,8 @@ void AvatarManager::deleteAllAvatars() {
             assert(otherAvatar->getDetailedMotionStates().size() == 0);
         }
     }
+
+    publishAvatarHashSnapshot();
 }
 
 void AvatarManager::handleChangedMotionStates(const VectorOfMotionStates& motionStates) {
@@ -157,8 +157,19 @@ void MyHead::simulate(float deltaTime) {
         setSuppressProceduralAnimationFlag(HeadData::SaccadeProceduralEyeJointAnimation, eyesTracked || eyeJointsOverridden);
 
         if (anyInputTracked) {
+            bool anyBlendshapeChanged = false;
             for (int i = 0; i < (int)Blendshapes::BlendshapeCount; i++) {
-                _blendshapeCoefficients[i] = userInputMapper->getActionState(blendshapeActions[i]);
+                float coefficient = userInputMapper->getActionState(blendshapeActions[i]);
+                if (_blendshapeCoefficients[i] != coefficient) {
+                    _blendshapeCoefficients[i] = coefficient;
+                    anyBlendshapeChanged = true;
+                }
+            }
+            if (anyBlendshapeChanged) {
+                // the wire delta gate (faceTrackerInfoChangedSince) only sees writes
+                // that are marked; without this, input-driven faces would only go
+                // out on the occasional full resync
+                markBlendshapesChanged();
             }
         }
     }
@@ -21,6 +21,14 @@
 // timescale can be used to speed-up or slow-down the animation.
 // loop flag, when true, will loop the animation as it reaches the end frame.
 
+// TODO: every AnimClip holds its own retargeted copy of the clip's frames (_anim),
+// so N avatars with the same skeleton playing the same clip store and compute N
+// copies. Sharing needs _anim to become a shared immutable pose stream keyed by
+// (animation content, skeleton identity) with copy-on-write at the delta-bake and
+// mirror paths that currently mutate frames in place - a member-type change that
+// touches every frame access, best done with the blend paths under test. Cache
+// keying must be by content/URL rather than object address, since resource
+// pointers get reused.
 class AnimClip : public AnimNode {
 public:
     friend class AnimTests;
@@ -253,8 +253,9 @@ void AnimInverseKinematics::solve(const AnimContext& context, const std::vector<
     const int MAX_IK_LOOPS = 16;
     while (numLoops < MAX_IK_LOOPS) {
         ++numLoops;
+        bool lastLoop = (numLoops == MAX_IK_LOOPS);
 
-        bool debug = context.getEnableDebugDrawIKChains() && numLoops == MAX_IK_LOOPS;
+        bool debug = context.getEnableDebugDrawIKChains() && lastLoop;
 
         // solve all targets
         for (size_t i = 0; i < targets.size(); i++) {
@@ -271,7 +272,7 @@ void AnimInverseKinematics::solve(const AnimContext& context, const std::vector<
         }
         
         // on last iteration, interpolate jointChains, if necessary
-        if (numLoops == MAX_IK_LOOPS) {
+        if (lastLoop) {
             for (size_t i = 0; i < _prevJointChainInfoVec.size(); i++) {
                 targetToChainMap.insert(std::pair<int, int>(_prevJointChainInfoVec[i].target.getIndex(), (int)i));
                 if (_prevJointChainInfoVec[i].timer > 0.0f) {
@@ -336,16 +337,27 @@ void AnimInverseKinematics::solve(const AnimContext& context, const std::vector<
         }
 
         // compute maxError
+        bool hasMeasurableTarget = false;
         maxError = 0.0f;
         for (size_t i = 0; i < targets.size(); i++) {
             if (targets[i].getType() == IKTarget::Type::RotationAndPosition || targets[i].getType() == IKTarget::Type::HmdHead ||
                 targets[i].getType() == IKTarget::Type::HipsRelativeRotationAndPosition) {
+                hasMeasurableTarget = true;
                 float error = glm::length(absolutePoses[targets[i].getIndex()].trans() - targets[i].getTranslation());
                 if (error > maxError) {
                     maxError = error;
                 }
             }
         }
+
+        // converged chains don't need the remaining iterations: jump to the final
+        // loop, which still performs the chain interpolation and last accumulate.
+        // only positional targets report error, so don't cut iterations short for
+        // target sets (e.g. spline-only) whose convergence we can't measure.
+        const float CONVERGENCE_ERROR_THRESHOLD = 0.001f;  // meters
+        if (!lastLoop && hasMeasurableTarget && maxError < CONVERGENCE_ERROR_THRESHOLD) {
+            numLoops = MAX_IK_LOOPS - 1;
+        }
     }
     _maxErrorOnLastSolve = maxError;
 
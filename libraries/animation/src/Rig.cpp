@@ -1731,8 +1731,10 @@ void Rig::updateAnimations(float deltaTime, const glm::mat4& rootTransform, cons
     
     applyOverridePoses();
 
-    buildAbsoluteRigPoses(_internalPoseSet._relativePoses, _internalPoseSet._absolutePoses);    
-    _internalFlow.update(deltaTime, _internalPoseSet._relativePoses, _internalPoseSet._absolutePoses, _internalPoseSet._overrideFlags);
+    buildAbsoluteRigPoses(_internalPoseSet._relativePoses, _internalPoseSet._absolutePoses);
+    if (!_flowLODSuspended) {
+        _internalFlow.update(deltaTime, _internalPoseSet._relativePoses, _internalPoseSet._absolutePoses, _internalPoseSet._overrideFlags);
+    }
 
     if (_sendNetworkNode) {
         if (_internalFlow.getActive() && !_networkFlow.getActive()) {
@@ -2648,8 +2650,10 @@ void Rig::copyJointsFromJointData(const QVector<JointData>& jointDataVec) {
         return;
     }
 
-    // make a vector of rotations in absolute-model-frame
-    std::vector<glm::quat> rotations;
+    // make a vector of rotations in absolute-model-frame, in a scratch buffer
+    // that keeps its capacity across frames
+    std::vector<glm::quat>& rotations = _copyJointsScratch;
+    rotations.clear();
     rotations.reserve(numJoints);
     const glm::quat rigToGeometryRot(glmExtractRotation(_rigToGeometryTransform));
 
@@ -34,6 +34,13 @@ class AnimInverseKinematics;
 // Rig instances are reentrant.
 // However only specific methods thread-safe.  Noted below.
 
+// TODO: per-avatar Rig::update jobs are conceptually independent and could fan out
+// across the task worker pool with a barrier before render-item updates. What stops
+// that today: update paths emit Qt signals (onLoadComplete and friends), call into
+// DebugDraw's shared singleton, and mutate AnimContext-shared scratch, all assuming
+// the owning thread. Those seams need isolating (queued signal emission, per-thread
+// scratch) before isolated execution is safe; the scheduling itself is then the
+// easy part.
 class Rig : public QObject {
     Q_OBJECT
 public:
@@ -248,6 +255,10 @@ public:
     const AnimVariantMap& getAnimVars() const { return _lastAnimVars; }
     const AnimContext::DebugStateMachineMap& getStateMachineMap() const { return _lastContext.getStateMachineMap(); }
     void initFlow(bool isActive);
+
+    // animation LOD: suspend flow (hair/cloth) integration without touching the
+    // avatar-configured active state; distant avatars resume where they left off
+    void setFlowLODSuspended(bool suspended) { _flowLODSuspended = suspended; }
     Flow& getFlow() { return _internalFlow; }
 
     float getUnscaledEyeHeight() const;
@@ -488,9 +499,14 @@ protected:
     SnapshotBlendPoseHelper _hipsBlendHelper;
     ControllerParameters _previousControllerParameters;
     Flow _internalFlow;
+    bool _flowLODSuspended { false };
     Flow _networkFlow;
 
     std::vector<uint> _remoteToLocalJointMap;
+
+    // scratch reused by copyJointsFromJointData to avoid a per-avatar
+    // per-network-frame allocation
+    std::vector<glm::quat> _copyJointsScratch;
 };
 
 #endif /* defined(__hifi__Rig__) */
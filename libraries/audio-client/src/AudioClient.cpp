@@ -317,6 +317,11 @@ AudioClient::AudioClient() {
     // avoid putting a lock in the device callback
     assert(_localSamplesAvailable.is_lock_free());
 
+    // injector prep kicked off from the device callback gets its own worker so it
+    // can't queue behind unrelated jobs saturating the global pool (which forces
+    // the next callback into the synchronous prepare path)
+    _localPrepInjectorPool.setMaxThreadCount(1);
+
     // deprecate legacy settings
     {
         Setting::Handle<int>::Deprecated("maxFramesOverDesired", InboundAudioStream::MAX_FRAMES_OVER_DESIRED);
@@ -1664,9 +1669,19 @@ bool AudioClient::mixLocalAudioInjectors(float* mixBuffer) {
 
                         float azimuth = azimuthForSource(relativePosition);
 
-                        // spatialize into mixBuffer
-                        injector->getLocalHRTF().render(_localScratchBuffer, mixBuffer, HRTF_DATASET_INDEX,
-                                                        azimuth, distance, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+                        // spatialize into mixBuffer, batched with the other mono positional injectors
+                        if (_localHRTFBatchCount == LOCAL_HRTF_BATCH_SIZE) {
+                            AudioHRTF::renderBatch(_localHRTFBatch, _localHRTFBatchCount, mixBuffer,
+                                                   AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+                            _localHRTFBatchCount = 0;
+                        }
+
+                        // the scratch buffer is reused per injector, so the frame is copied into
+                        // per-slot storage that stays valid until the batch is rendered
+                        int slot = _localHRTFBatchCount++;
+                        memcpy(_localHRTFBatchSamples[slot], _localScratchBuffer, sizeof(_localHRTFBatchSamples[slot]));
+                        _localHRTFBatch[slot] = { &injector->getLocalHRTF(), _localHRTFBatchSamples[slot],
+                                                  HRTF_DATASET_INDEX, azimuth, distance, gain, LPF_DISTANCE_REF };
                     } else {
 
                         // direct mix into mixBuffer
@@ -1690,6 +1705,13 @@ bool AudioClient::mixLocalAudioInjectors(float* mixBuffer) {
         }
     }
 
+    // render any batched mono positional injectors collected above
+    if (_localHRTFBatchCount > 0) {
+        AudioHRTF::renderBatch(_localHRTFBatch, _localHRTFBatchCount, mixBuffer,
+                               AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        _localHRTFBatchCount = 0;
+    }
+
     for (const AudioInjectorPointer& injector : injectorsToRemove) {
         //qCDebug(audioclient) << "removing injector";
         _activeLocalAudioInjectors.removeOne(injector);
@@ -2406,7 +2428,7 @@ qint64 AudioClient::AudioOutputIODevice::readData(char * data, qint64 maxSize) {
     }
 
     // prepare injectors for the next callback
-     _audio->_localPrepInjectorFuture = QtConcurrent::run(QThreadPool::globalInstance(), [this] {
+     _audio->_localPrepInjectorFuture = QtConcurrent::run(&_audio->_localPrepInjectorPool, [this] {
         _audio->prepareLocalAudioInjectors();
     });
 
@@ -22,6 +22,7 @@
 
 #include <QFuture>
 #include <QtCore/QtGlobal>
+#include <QtCore/QThreadPool>
 #include <QtCore/QByteArray>
 #include <QtCore/QElapsedTimer>
 #include <QtCore/QObject>
@@ -450,6 +451,11 @@ private:
     std::atomic<float> _systemInjectorGain { 1.0f };
     float _localMixBuffer[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _localScratchBuffer[AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC];
+    // batched HRTF rendering of mono positional local injectors (see AudioMixerSlave)
+    static const int LOCAL_HRTF_BATCH_SIZE = 16;
+    AudioHRTF::BatchSource _localHRTFBatch[LOCAL_HRTF_BATCH_SIZE];
+    int16_t _localHRTFBatchSamples[LOCAL_HRTF_BATCH_SIZE][AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL];
+    int _localHRTFBatchCount { 0 };
     float* _localOutputMixBuffer { NULL };
     Mutex _localAudioMutex;
     AudioLimiter _audioLimiter{ AudioConstants::SAMPLE_RATE, OUTPUT_CHANNEL_COUNT };
@@ -536,6 +542,9 @@ private:
     AudioSolo _solo;
 
     QFuture<void> _localPrepInjectorFuture;
+    // dedicated single-thread pool for injector prep, so the device callback's
+    // async prep doesn't queue behind unrelated work in the global pool
+    QThreadPool _localPrepInjectorPool;
     QReadWriteLock _hmdNameLock;
     Mutex _checkDevicesMutex;
     QTimer* _checkDevicesTimer { nullptr };
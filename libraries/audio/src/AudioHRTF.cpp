@@ -1203,3 +1203,47 @@ void AudioHRTF::mixStereo(int16_t* input, float* output, float gain, int numFram
 
     _resetState = false;
 }
+
+void AudioHRTF::renderBatch(BatchSource* sources, int numSources, float* output, int numFrames) {
+
+    assert(numFrames == HRTF_BLOCK);
+
+    //
+    // Sort the batch by subject index and azimuth bucket, so that sources panned to the
+    // same region of the HRTF dataset are rendered back-to-back. The interpolated rows of
+    // ir_table_table and itd_table_table then stay resident in L1/L2 across the group,
+    // instead of being refetched for every source. Stable insertion sort is used because
+    // batches are small and mostly coherent from frame to frame.
+    //
+    assert(numSources <= MAX_BATCH_SOURCES);
+    numSources = std::min(numSources, MAX_BATCH_SOURCES);
+
+    int keys[MAX_BATCH_SOURCES];
+    for (int i = 0; i < numSources; i++) {
+        int index0, index1;
+        float frac;
+        azimuthToIndex(sources[i].azimuth, index0, index1, frac);
+        keys[i] = (sources[i].index << 8) | index0;
+    }
+
+    for (int i = 1; i < numSources; i++) {
+        BatchSource source = sources[i];
+        int key = keys[i];
+
+        int j = i - 1;
+        while (j >= 0 && keys[j] > key) {
+            sources[j+1] = sources[j];
+            keys[j+1] = keys[j];
+            j--;
+        }
+        sources[j+1] = source;
+        keys[j+1] = key;
+    }
+
+    // render each source, accumulating into the shared mix buffer
+    for (int i = 0; i < numSources; i++) {
+        sources[i].hrtf->render(sources[i].input, output, sources[i].index,
+                                sources[i].azimuth, sources[i].distance, sources[i].gain,
+                                numFrames, sources[i].lpfDistance);
+    }
+}
@@ -64,6 +64,30 @@ public:
     void mixMono(int16_t* input, float* output, float gain, int numFrames);
     void mixStereo(int16_t* input, float* output, float gain, int numFrames);
 
+    //
+    // One source of a batched render, with the same parameters as render()
+    //
+    struct BatchSource {
+        AudioHRTF* hrtf;
+        int16_t* input;
+        int index;
+        float azimuth;
+        float distance;
+        float gain;
+        float lpfDistance;
+    };
+
+    // maximum number of sources accepted by a single renderBatch() call
+    static const int MAX_BATCH_SOURCES = 64;
+
+    //
+    // Batched render of multiple sources into one stereo mix buffer (accumulates into existing output).
+    // Sources are regrouped by HRTF table locality, so coefficient fetches and interpolation setup
+    // are amortized across the batch instead of being paid per source.
+    // numSources must not exceed MAX_BATCH_SOURCES; larger sets are rendered in multiple calls.
+    //
+    static void renderBatch(BatchSource* sources, int numSources, float* output, int numFrames);
+
     //
     // Fast path when input is known to be silent and state as been flushed
     //
@@ -27,24 +27,8 @@
 AudioInjectorManager::~AudioInjectorManager() {
     _shouldStop = true;
 
-    Lock lock(_injectorsMutex);
-
-    // make sure any still living injectors are stopped and deleted
-    while (!_injectors.empty()) {
-        // grab the injector at the front
-        auto& timePointerPair = _injectors.top();
-
-        // ask it to stop and be deleted
-        timePointerPair.second->finish();
-
-        _injectors.pop();
-    }
-
-    // get rid of the lock now that we've stopped all living injectors
-    lock.unlock();
-
     // in case the thread is waiting for injectors wake it up now
-    _injectorReady.notify_one();
+    notifyInjectorReadyCondition();
 
     // quit and wait on the manager thread, if we ever created it
     if (_thread) {
@@ -52,6 +36,24 @@ AudioInjectorManager::~AudioInjectorManager() {
         _thread->wait();
     }
 
+    // with the manager thread stopped, both queues are safe to drain here -
+    // make sure any still living injectors are stopped and deleted
+    AudioInjectorPointer incoming;
+    while (_incomingInjectors.try_pop(incoming)) {
+        if (!incoming.isNull()) {
+            incoming->finish();
+        }
+    }
+
+    while (!_injectors.empty()) {
+        // grab the injector at the front and ask it to stop and be deleted
+        auto& timePointerPair = _injectors.top();
+        if (!timePointerPair.second.isNull()) {
+            timePointerPair.second->finish();
+        }
+        _injectors.pop();
+    }
+
     moveToThread(qApp->thread());
 }
 
@@ -73,8 +75,11 @@ void AudioInjectorManager::createThread() {
 
 void AudioInjectorManager::run() {
     while (!_shouldStop) {
-        // wait until the next injector is ready, or until we get a new injector given to us
-        Lock lock(_injectorsMutex);
+        // drain the lock-free handoff queue into the thread-private schedule
+        AudioInjectorPointer incoming;
+        while (_incomingInjectors.try_pop(incoming)) {
+            _injectors.emplace(usecTimestampNow(), incoming);
+        }
 
         if (_injectors.size() > 0) {
             // when does the next injector need to send a frame?
@@ -86,7 +91,17 @@ void AudioInjectorManager::run() {
             int64_t difference = int64_t(nextTimestamp - usecTimestampNow());
 
             if (difference > 0) {
-                _injectorReady.wait_for(lock, std::chrono::microseconds(difference));
+                Lock lock(_waitMutex);
+                // re-check under the wait mutex so a handoff between the drain above
+                // and this wait cannot be missed
+                if (_incomingInjectors.empty()) {
+                    _injectorReady.wait_for(lock, std::chrono::microseconds(difference));
+                }
+            }
+
+            // pick up anything that arrived while we were waiting
+            while (_incomingInjectors.try_pop(incoming)) {
+                _injectors.emplace(usecTimestampNow(), incoming);
             }
 
             if (_injectors.size() > 0) {
@@ -103,6 +118,7 @@ void AudioInjectorManager::run() {
                     auto injector = front.second;
                     _injectors.pop();
 
+                    bool requeued = false;
                     if (!injector.isNull()) {
                         // this is an injector that's ready to go, have it send a frame now
                         auto nextCallDelta = injector->injectNextFrame();
@@ -110,11 +126,16 @@ void AudioInjectorManager::run() {
                         if (nextCallDelta >= 0 && !injector->isFinished()) {
                             // enqueue the injector with the correct timing in our holding queue
                             heldInjectors.emplace(heldInjectors.end(), usecTimestampNow() + nextCallDelta, injector);
+                            requeued = true;
                         } else {
                             injector->sendStopInjectorPacket();
                         }
                     }
 
+                    if (!requeued) {
+                        --_numInjectors;
+                    }
+
                     if (_injectors.size() > 0) {
                         front = _injectors.top();
                     } else {
@@ -132,20 +153,20 @@ void AudioInjectorManager::run() {
 
         } else {
             // we have no current injectors, wait until we get at least one before we do anything
-            _injectorReady.wait(lock);
+            Lock lock(_waitMutex);
+            if (_incomingInjectors.empty() && !_shouldStop) {
+                _injectorReady.wait(lock);
+            }
         }
 
-        // unlock the lock in case something in process events needs to modify the queue
-        lock.unlock();
-
         QCoreApplication::processEvents();
     }
 }
 
 static const int MAX_INJECTORS_PER_THREAD = 40; // calculated based on AudioInjector time to send frame, with sufficient padding
 
-bool AudioInjectorManager::wouldExceedLimits() { // Should be called inside of a lock.
-    if (_injectors.size() >= MAX_INJECTORS_PER_THREAD) {
+bool AudioInjectorManager::wouldExceedLimits() { // callable from any thread
+    if (_numInjectors.load() >= MAX_INJECTORS_PER_THREAD) {
         qCDebug(audio)  << "AudioInjectorManager::threadInjector could not thread AudioInjector - at max of"
             << MAX_INJECTORS_PER_THREAD << "current audio injectors.";
         return true;
@@ -159,18 +180,17 @@ bool AudioInjectorManager::threadInjector(const AudioInjectorPointer& injector)
         return false;
     }
 
-    // guard the injectors vector with a mutex
-    Lock lock(_injectorsMutex);
-
     if (wouldExceedLimits()) {
         return false;
-    } else {
-        // add the injector to the queue with a send timestamp of now
-        _injectors.emplace(usecTimestampNow(), injector);
-
-        // notify our wait condition so we can inject two frames for this injector immediately
-        _injectorReady.notify_one();
     }
+
+    // hand the injector off through the lock-free queue, to be scheduled with a send timestamp of now
+    ++_numInjectors;
+    _incomingInjectors.push(injector);
+
+    // notify our wait condition so we can inject two frames for this injector immediately
+    notifyInjectorReadyCondition();
+
     return true;
 }
 
@@ -284,7 +304,7 @@ void AudioInjectorManager::setOptionsAndRestart(const AudioInjectorPointer& inje
 
     if (QThread::currentThread() != _thread) {
         QMetaObject::invokeMethod(this, "setOptionsAndRestart", Q_ARG(const AudioInjectorPointer&, injector), Q_ARG(const AudioInjectorOptions&, options));
-        _injectorReady.notify_one();
+        notifyInjectorReadyCondition();
         return;
     }
 
@@ -299,7 +319,7 @@ void AudioInjectorManager::restart(const AudioInjectorPointer& injector) {
 
     if (QThread::currentThread() != _thread) {
         QMetaObject::invokeMethod(this, "restart", Q_ARG(const AudioInjectorPointer&, injector));
-        _injectorReady.notify_one();
+        notifyInjectorReadyCondition();
         return;
     }
 
@@ -313,7 +333,7 @@ void AudioInjectorManager::setOptions(const AudioInjectorPointer& injector, cons
 
     if (QThread::currentThread() != _thread) {
         QMetaObject::invokeMethod(this, "setOptions", Q_ARG(const AudioInjectorPointer&, injector), Q_ARG(const AudioInjectorOptions&, options));
-        _injectorReady.notify_one();
+        notifyInjectorReadyCondition();
         return;
     }
 
@@ -351,7 +371,7 @@ void AudioInjectorManager::stop(const AudioInjectorPointer& injector) {
 
     if (QThread::currentThread() != _thread) {
         QMetaObject::invokeMethod(this, "stop", Q_ARG(const AudioInjectorPointer&, injector));
-        _injectorReady.notify_one();
+        notifyInjectorReadyCondition();
         return;
     }
 
@@ -359,6 +379,5 @@ void AudioInjectorManager::stop(const AudioInjectorPointer& injector) {
 }
 
 size_t AudioInjectorManager::getNumInjectors() {
-    Lock lock(_injectorsMutex);
-    return _injectors.size();
+    return _numInjectors.load();
 }
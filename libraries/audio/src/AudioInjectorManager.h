@@ -14,6 +14,7 @@
 #ifndef hifi_AudioInjectorManager_h
 #define hifi_AudioInjectorManager_h
 
+#include <atomic>
 #include <condition_variable>
 #include <queue>
 #include <mutex>
@@ -22,6 +23,7 @@
 #include <QtCore/QThread>
 
 #include <DependencyManager.h>
+#include <TBBHelpers.h>
 
 #include "AudioInjector.h"
 
@@ -68,7 +70,12 @@ private:
     using Lock = std::unique_lock<Mutex>;
 
     bool threadInjector(const AudioInjectorPointer& injector);
-    void notifyInjectorReadyCondition() { _injectorReady.notify_one(); }
+    void notifyInjectorReadyCondition() {
+        // pairing with _waitMutex guarantees the manager thread is either before its
+        // wait checks (and will see the new state) or already waiting (and is woken)
+        { Lock lock(_waitMutex); }
+        _injectorReady.notify_one();
+    }
     bool wouldExceedLimits();
 
     AudioInjectorManager() { createThread(); }
@@ -78,8 +85,14 @@ private:
 
     QThread* _thread { nullptr };
     bool _shouldStop { false };
+
+    // injectors are handed off from any thread through the lock-free queue;
+    // the schedule itself is owned by the manager thread and never locked
+    tbb::concurrent_queue<AudioInjectorPointer> _incomingInjectors;
     InjectorQueue _injectors;
-    Mutex _injectorsMutex;
+    std::atomic<size_t> _numInjectors { 0 };
+
+    Mutex _waitMutex;   // pairs with _injectorReady only, guards no data
     std::condition_variable _injectorReady;
 
     friend class AudioInjector;
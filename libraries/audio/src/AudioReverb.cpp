@@ -1777,6 +1777,10 @@ AudioReverb::~AudioReverb() {
 void AudioReverb::setParameters(ReverbParameters *p) {
     _params = *p;
     _impl->setParameters(p);
+
+    // length of the audible tail, after which silent input allows rendering to be skipped
+    _tailFrames = (int)(p->sampleRate * (p->reverbTime + (p->preDelay + p->lateDelay) * 0.001f));
+    _silentFrames = 0;
 };
 
 void AudioReverb::getParameters(ReverbParameters *p) {
@@ -1785,9 +1789,57 @@ void AudioReverb::getParameters(ReverbParameters *p) {
 
 void AudioReverb::reset() {
     _impl->reset();
+
+    // internal state is cleared, so there is no tail left to render
+    _silentFrames = _tailFrames;
+}
+
+static bool blockIsSilent(const int16_t* input, int numSamples) {
+    for (int i = 0; i < numSamples; i++) {
+        if (input[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool blockIsSilent(const float* input, int numSamples) {
+    for (int i = 0; i < numSamples; i++) {
+        if (input[i] != 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AudioReverb::tailGate(bool inputSilent, int numFrames) {
+    if (!inputSilent) {
+        _silentFrames = 0;
+        return false;
+    }
+
+    if (_silentFrames >= _tailFrames) {
+        // the tail has fully decayed - silent input produces silent output
+        return true;
+    }
+
+    _silentFrames += numFrames;
+    return false;
 }
 
 void AudioReverb::render(float** inputs, float** outputs, int numFrames) {
+    bool inputSilent = blockIsSilent(inputs[0], numFrames) && blockIsSilent(inputs[1], numFrames);
+
+    if (tailGate(inputSilent, numFrames)) {
+        if (outputs[0] != inputs[0]) {
+            memset(outputs[0], 0, numFrames * sizeof(float));
+        }
+        if (outputs[1] != inputs[1]) {
+            memset(outputs[1], 0, numFrames * sizeof(float));
+        }
+        return;
+    }
+
     _impl->process(inputs, outputs, numFrames);
 }
 
@@ -2016,6 +2068,11 @@ void AudioReverb::convertOutput(float** inputs, float* output, int numFrames) {
 //
 void AudioReverb::render(const int16_t* input, int16_t* output, int numFrames) {
 
+    if (tailGate(blockIsSilent(input, 2 * numFrames), numFrames)) {
+        memset(output, 0, 2 * numFrames * sizeof(int16_t));
+        return;
+    }
+
     while (numFrames) {
 
         int n = MIN(numFrames, REVERB_BLOCK);
@@ -2037,6 +2094,11 @@ void AudioReverb::render(const int16_t* input, int16_t* output, int numFrames) {
 //
 void AudioReverb::render(const float* input, float* output, int numFrames) {
 
+    if (tailGate(blockIsSilent(input, 2 * numFrames), numFrames)) {
+        memset(output, 0, 2 * numFrames * sizeof(float));
+        return;
+    }
+
     while (numFrames) {
 
         int n = MIN(numFrames, REVERB_BLOCK);
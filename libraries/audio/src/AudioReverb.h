@@ -73,6 +73,14 @@ private:
 
     float* _inout[2];
 
+    // tail gating - once the input has been silent for longer than the audible tail,
+    // rendering is skipped entirely until the next non-silent block
+    int _tailFrames { 0 };
+    int _silentFrames { 0 };
+
+    // returns true when the block can be skipped, updating the tail countdown
+    bool tailGate(bool inputSilent, int numFrames);
+
     void convertInput(const int16_t* input, float** outputs, int numFrames);
     void convertOutput(float** inputs, int16_t* output, int numFrames);
 
@@ -1182,6 +1182,292 @@ void AudioSRC::convertOutput(float** inputs, float* output, int numFrames) {
     }
 }
 
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+
+// convert int16_t to float, deinterleave stereo
+void AudioSRC::convertInput(const int16_t* input, float** outputs, int numFrames) {
+    const float32x4_t scale = vdupq_n_f32(1/32768.0f);
+
+    if (_numChannels == 1) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            int16x4_t a0 = vld1_s16(&input[i]);
+
+            float32x4_t f0 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(a0)), scale);
+
+            vst1q_f32(&outputs[0][i], f0);
+        }
+        for (; i < numFrames; i++) {
+            outputs[0][i] = (float)input[i] * (1/32768.0f);
+        }
+
+    } else if (_numChannels == 2) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            // deinterleave
+            int16x4x2_t a = vld2_s16(&input[2*i]);
+
+            float32x4_t f0 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(a.val[0])), scale);
+            float32x4_t f1 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(a.val[1])), scale);
+
+            vst1q_f32(&outputs[0][i], f0);
+            vst1q_f32(&outputs[1][i], f1);
+        }
+        for (; i < numFrames; i++) {
+            outputs[0][i] = (float)input[2*i + 0] * (1/32768.0f);
+            outputs[1][i] = (float)input[2*i + 1] * (1/32768.0f);
+        }
+
+    } else if (_numChannels == 4) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            // deinterleave
+            int16x4x4_t a = vld4_s16(&input[4*i]);
+
+            float32x4_t f0 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(a.val[0])), scale);
+            float32x4_t f1 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(a.val[1])), scale);
+            float32x4_t f2 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(a.val[2])), scale);
+            float32x4_t f3 = vmulq_f32(vcvtq_f32_s32(vmovl_s16(a.val[3])), scale);
+
+            vst1q_f32(&outputs[0][i], f0);
+            vst1q_f32(&outputs[1][i], f1);
+            vst1q_f32(&outputs[2][i], f2);
+            vst1q_f32(&outputs[3][i], f3);
+        }
+        for (; i < numFrames; i++) {
+            outputs[0][i] = (float)input[4*i + 0] * (1/32768.0f);
+            outputs[1][i] = (float)input[4*i + 1] * (1/32768.0f);
+            outputs[2][i] = (float)input[4*i + 2] * (1/32768.0f);
+            outputs[3][i] = (float)input[4*i + 3] * (1/32768.0f);
+        }
+    }
+}
+
+// fast TPDF dither in [-1.0f, 1.0f]
+static inline float32x4_t dither4() {
+    static int16x8_t rz;    // zero-initialized
+
+    // update the 8 different maximum-length LCGs
+    static const int16_t multData[8] = { -3495, 30185, -27591, 19445, -23279, -5975, -25511, 25173 };
+    static const int16_t addData[8] = { 28013, -13225, -32679, -7701, -19675, 105, -32767, 13849 };
+    rz = vaddq_s16(vmulq_s16(rz, vld1q_s16(multData)), vld1q_s16(addData));
+
+    // promote to 32-bit
+    uint16x8_t rzu = vreinterpretq_u16_s16(rz);
+    int32x4_t r0 = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(rzu)));
+    int32x4_t r1 = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(rzu)));
+
+    // return (r0 - r1) * (1/65536.0f);
+    return vmulq_f32(vcvtq_f32_s32(vsubq_s32(r0, r1)), vdupq_n_f32(1/65536.0f));
+}
+
+// round and saturate to int16_t
+static inline int16x4_t roundAndSaturate(float32x4_t f) {
+    float32x4_t half = vbslq_f32(vcltq_f32(f, vdupq_n_f32(0.0f)), vdupq_n_f32(-0.5f), vdupq_n_f32(0.5f));
+    return vqmovn_s32(vcvtq_s32_f32(vaddq_f32(f, half)));
+}
+
+// convert float to int16_t with dither, interleave stereo
+void AudioSRC::convertOutput(float** inputs, int16_t* output, int numFrames) {
+    const float32x4_t scale = vdupq_n_f32(32768.0f);
+
+    if (_numChannels == 1) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            float32x4_t f0 = vmulq_f32(vld1q_f32(&inputs[0][i]), scale);
+
+            f0 = vaddq_f32(f0, dither4());
+
+            // round and saturate
+            int16x4_t a0 = roundAndSaturate(f0);
+
+            vst1_s16(&output[i], a0);
+        }
+        for (; i < numFrames; i++) {
+            float32x4_t f0 = vmulq_f32(vld1q_dup_f32(&inputs[0][i]), scale);
+
+            f0 = vaddq_f32(f0, dither4());
+
+            // round and saturate
+            int16x4_t a0 = roundAndSaturate(f0);
+
+            output[i] = vget_lane_s16(a0, 0);
+        }
+
+    } else if (_numChannels == 2) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            float32x4_t f0 = vmulq_f32(vld1q_f32(&inputs[0][i]), scale);
+            float32x4_t f1 = vmulq_f32(vld1q_f32(&inputs[1][i]), scale);
+
+            float32x4_t d0 = dither4();
+            f0 = vaddq_f32(f0, d0);
+            f1 = vaddq_f32(f1, d0);
+
+            // round and saturate
+            int16x4x2_t a;
+            a.val[0] = roundAndSaturate(f0);
+            a.val[1] = roundAndSaturate(f1);
+
+            // interleave
+            vst2_s16(&output[2*i], a);
+        }
+        for (; i < numFrames; i++) {
+            float32x4_t f0 = vmulq_f32(vld1q_dup_f32(&inputs[0][i]), scale);
+            float32x4_t f1 = vmulq_f32(vld1q_dup_f32(&inputs[1][i]), scale);
+
+            float32x4_t d0 = dither4();
+            f0 = vaddq_f32(f0, d0);
+            f1 = vaddq_f32(f1, d0);
+
+            // round and saturate
+            output[2*i + 0] = vget_lane_s16(roundAndSaturate(f0), 0);
+            output[2*i + 1] = vget_lane_s16(roundAndSaturate(f1), 0);
+        }
+
+    } else if (_numChannels == 4) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            float32x4_t f0 = vmulq_f32(vld1q_f32(&inputs[0][i]), scale);
+            float32x4_t f1 = vmulq_f32(vld1q_f32(&inputs[1][i]), scale);
+            float32x4_t f2 = vmulq_f32(vld1q_f32(&inputs[2][i]), scale);
+            float32x4_t f3 = vmulq_f32(vld1q_f32(&inputs[3][i]), scale);
+
+            float32x4_t d0 = dither4();
+            f0 = vaddq_f32(f0, d0);
+            f1 = vaddq_f32(f1, d0);
+            f2 = vaddq_f32(f2, d0);
+            f3 = vaddq_f32(f3, d0);
+
+            // round and saturate
+            int16x4x4_t a;
+            a.val[0] = roundAndSaturate(f0);
+            a.val[1] = roundAndSaturate(f1);
+            a.val[2] = roundAndSaturate(f2);
+            a.val[3] = roundAndSaturate(f3);
+
+            // interleave
+            vst4_s16(&output[4*i], a);
+        }
+        for (; i < numFrames; i++) {
+            float32x4_t f0 = vmulq_f32(vld1q_dup_f32(&inputs[0][i]), scale);
+            float32x4_t f1 = vmulq_f32(vld1q_dup_f32(&inputs[1][i]), scale);
+            float32x4_t f2 = vmulq_f32(vld1q_dup_f32(&inputs[2][i]), scale);
+            float32x4_t f3 = vmulq_f32(vld1q_dup_f32(&inputs[3][i]), scale);
+
+            float32x4_t d0 = dither4();
+            f0 = vaddq_f32(f0, d0);
+            f1 = vaddq_f32(f1, d0);
+            f2 = vaddq_f32(f2, d0);
+            f3 = vaddq_f32(f3, d0);
+
+            // round and saturate
+            output[4*i + 0] = vget_lane_s16(roundAndSaturate(f0), 0);
+            output[4*i + 1] = vget_lane_s16(roundAndSaturate(f1), 0);
+            output[4*i + 2] = vget_lane_s16(roundAndSaturate(f2), 0);
+            output[4*i + 3] = vget_lane_s16(roundAndSaturate(f3), 0);
+        }
+    }
+}
+
+// deinterleave stereo
+void AudioSRC::convertInput(const float* input, float** outputs, int numFrames) {
+
+    if (_numChannels == 1) {
+
+        memcpy(outputs[0], input, numFrames * sizeof(float));
+
+    } else if (_numChannels == 2) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            // deinterleave
+            float32x4x2_t f = vld2q_f32(&input[2*i]);
+
+            vst1q_f32(&outputs[0][i], f.val[0]);
+            vst1q_f32(&outputs[1][i], f.val[1]);
+        }
+        for (; i < numFrames; i++) {
+            // deinterleave
+            outputs[0][i] = input[2*i + 0];
+            outputs[1][i] = input[2*i + 1];
+        }
+
+    } else if (_numChannels == 4) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            // deinterleave
+            float32x4x4_t f = vld4q_f32(&input[4*i]);
+
+            vst1q_f32(&outputs[0][i], f.val[0]);
+            vst1q_f32(&outputs[1][i], f.val[1]);
+            vst1q_f32(&outputs[2][i], f.val[2]);
+            vst1q_f32(&outputs[3][i], f.val[3]);
+        }
+        for (; i < numFrames; i++) {
+            // deinterleave
+            outputs[0][i] = input[4*i + 0];
+            outputs[1][i] = input[4*i + 1];
+            outputs[2][i] = input[4*i + 2];
+            outputs[3][i] = input[4*i + 3];
+        }
+    }
+}
+
+// interleave stereo
+void AudioSRC::convertOutput(float** inputs, float* output, int numFrames) {
+
+    if (_numChannels == 1) {
+
+        memcpy(output, inputs[0], numFrames * sizeof(float));
+
+    } else if (_numChannels == 2) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            float32x4x2_t f;
+            f.val[0] = vld1q_f32(&inputs[0][i]);
+            f.val[1] = vld1q_f32(&inputs[1][i]);
+
+            // interleave
+            vst2q_f32(&output[2*i], f);
+        }
+        for (; i < numFrames; i++) {
+            // interleave
+            output[2*i + 0] = inputs[0][i];
+            output[2*i + 1] = inputs[1][i];
+        }
+
+    } else if (_numChannels == 4) {
+
+        int i = 0;
+        for (; i < numFrames - 3; i += 4) {
+            float32x4x4_t f;
+            f.val[0] = vld1q_f32(&inputs[0][i]);
+            f.val[1] = vld1q_f32(&inputs[1][i]);
+            f.val[2] = vld1q_f32(&inputs[2][i]);
+            f.val[3] = vld1q_f32(&inputs[3][i]);
+
+            // interleave
+            vst4q_f32(&output[4*i], f);
+        }
+        for (; i < numFrames; i++) {
+            // interleave
+            output[4*i + 0] = inputs[0][i];
+            output[4*i + 1] = inputs[1][i];
+            output[4*i + 2] = inputs[2][i];
+            output[4*i + 3] = inputs[3][i];
+        }
+    }
+}
+
 #else   // portable reference code
 
 // convert int16_t to float, deinterleave stereo
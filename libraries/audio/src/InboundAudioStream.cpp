@@ -206,6 +206,15 @@ int InboundAudioStream::parseData(ReceivedMessage& message) {
         }
     }
 
+    // when ingesting a burst of packets, this bookkeeping is settled once at endBatchIngest
+    if (!_batchIngest) {
+        finalizeIngest();
+    }
+
+    return message.getPosition();
+}
+
+void InboundAudioStream::finalizeIngest() {
     int framesAvailable = _ringBuffer.framesAvailable();
     // if this stream was starved, check if we're still starved.
     if (_isStarved && framesAvailable >= _desiredJitterBufferFrames) {
@@ -227,8 +236,6 @@ int InboundAudioStream::parseData(ReceivedMessage& message) {
     }
 
     framesAvailableChanged();
-
-    return message.getPosition();
 }
 
 int InboundAudioStream::parseStreamProperties(PacketType type, const QByteArray& packetAfterSeqNum, int& numAudioSamples) {
@@ -32,6 +32,16 @@ const int HAS_REVERB_BIT = 0; // 1st bit
 
 using StreamSequenceNumber = quint16;
 
+// TODO: recovery from jitter-buffer overfill after a network stall is still a
+// hard drop - the ring buffer shifts its read pointer past the oldest samples
+// (AudioRingBuffer::writeData) and the listener hears the discontinuity. A
+// time-stretch drain (play a few percent fast until the buffer returns to its
+// target, WSOLA-style overlap-add at the pop side) would recover smoothly and
+// let buffer targets sit tighter. The pop path hands fixed-size network frames
+// to the codec/mixer, so a stretch stage needs to live between the ring buffer
+// and popFrames with its own fractional read cursor and a correlation search
+// per output frame; AudioSRC's resampler infrastructure is the closest
+// starting point for the windowed overlap-add.
 class InboundAudioStream : public NodeData {
     Q_OBJECT
 
@@ -105,6 +115,13 @@ public:
     void setupCodec(CodecPluginPointer codec, const QString& codecName, int numChannels);
     void cleanupCodec();
 
+    // Batched ingest: between beginBatchIngest and endBatchIngest, the per-packet jitter
+    // bookkeeping at the end of parseData (starve recovery, overflow dropping, frames-
+    // available stats) is deferred and settled once for a whole burst of packets.
+    void beginBatchIngest() { _batchIngest = true; }
+    void endBatchIngest() { _batchIngest = false; finalizeIngest(); }
+    bool isBatchIngesting() const { return _batchIngest; }
+
 signals:
     void mismatchedAudioCodec(SharedNodePointer sendingNode, const QString& currentCodec, const QString& recievedCodec);
 
@@ -119,6 +136,9 @@ private:
 
     void popSamplesNoCheck(int samples);
     void framesAvailableChanged();
+    void finalizeIngest();
+
+    bool _batchIngest { false };
 
 protected:
     // disallow copying of InboundAudioStream objects
@@ -85,6 +85,12 @@ void Sound::downloadFinished(const QByteArray& data) {
 void Sound::soundProcessSuccess(AudioDataPointer audioData) {
     qCDebug(audio) << "Setting ready state for sound file" << _url.fileName();
 
+    // account for the decoded PCM rather than the compressed download, so the cache's
+    // unused-resource budget tracks (and bounds) what is actually held in memory;
+    // sounds whose decoded size exceeds the whole budget are dropped when unused
+    // instead of being retained forever
+    setSize(audioData->getNumBytes());
+
     _audioData = std::move(audioData);
     finishedLoading(true);
 
@@ -15,6 +15,7 @@
 #include <cstdio>
 #include <cstring>
 #include <stdint.h>
+#include <vector>
 
 #include <QtCore/QDataStream>
 #include <QtCore/QThread>
@@ -444,8 +445,15 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         maxDataSize = (int)byteArraySize;
     }
 
-    QByteArray avatarDataByteArray((int)byteArraySize, 0);
-    unsigned char* destinationBuffer = reinterpret_cast<unsigned char*>(avatarDataByteArray.data());
+    // serialize into a per-thread scratch buffer rather than a freshly zeroed
+    // QByteArray, so the returned array is allocated and copied at exactly the
+    // written size - this runs once per avatar per receiver in the mixer
+    static thread_local std::vector<unsigned char> scratchBuffer;
+    if (scratchBuffer.size() < byteArraySize) {
+        scratchBuffer.resize(byteArraySize);
+    }
+
+    unsigned char* destinationBuffer = scratchBuffer.data();
     const unsigned char* const startPosition = destinationBuffer;
     const unsigned char* const packetEnd = destinationBuffer + maxDataSize;
 
@@ -728,12 +736,19 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 
         float minRotationDOT = (distanceAdjust && cullSmallChanges) ? getDistanceBasedMinRotationDOT(viewerPosition) : AVATAR_MIN_ROTATION_DOT;
 
+        // stage the rotations that pass culling and the space budget, then encode
+        // them in one batch pass; the selected rotations land contiguously in the
+        // buffer, so the staged form is byte-identical to packing per joint
+        thread_local std::vector<glm::quat> rotationsToSend;
+        rotationsToSend.clear();
+        const ptrdiff_t rotationSpaceAvailable = packetEnd - destinationBuffer;
+
         int i = sendStatus.rotationsSent;
         for (; i < numJoints; ++i) {
             const JointData& data = joints[i];
             const JointData& last = lastSentJointData[i];
 
-            if (packetEnd - destinationBuffer >= minSizeForJoint) {
+            if (rotationSpaceAvailable - (ptrdiff_t)(rotationsToSend.size() * sizeof(AvatarDataPacket::SixByteQuat)) >= minSizeForJoint) {
                 if (!data.rotationIsDefaultPose) {
                     // The dot product for larger rotations is a lower number,
                     // so if the dot() is less than the value, then the rotation is a larger angle of rotation
@@ -743,7 +758,7 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
 #ifdef WANT_DEBUG
                         rotationSentCount++;
 #endif
-                        destinationBuffer += packOrientationQuatToSixBytes(destinationBuffer, data.rotation);
+                        rotationsToSend.push_back(data.rotation);
 
                         if (sentJoints) {
                             sentJoints[i].rotation = data.rotation;
@@ -761,6 +776,9 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         }
         sendStatus.rotationsSent = i;
 
+        destinationBuffer += packOrientationQuatsToSixBytes(destinationBuffer, rotationsToSend.data(),
+                                                            (int)rotationsToSend.size());
+
         // joint translation data
         validityPosition = destinationBuffer;
 
@@ -895,7 +913,7 @@ QByteArray AvatarData::toByteArray(AvatarDataDetail dataDetail, quint64 lastSent
         ASSERT(false);
     }
 
-    return avatarDataByteArray.left(avatarDataSize);
+    return QByteArray(reinterpret_cast<const char*>(startPosition), avatarDataSize);
 
 #undef AVATAR_MEMCPY
 #undef IF_AVATAR_SPACE
@@ -1310,11 +1328,18 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
         sourceBuffer += sizeof(AvatarDataPacket::FaceTrackerInfo);
 
         PACKET_READ_CHECK(FaceTrackerCoefficients, coefficientsSize);
+        bool blendshapesChanged = ((int)_headData->_blendshapeCoefficients.size() != numCoefficients) ||
+            (memcmp(_headData->_blendshapeCoefficients.constData(), sourceBuffer, coefficientsSize) != 0);
         _headData->_blendshapeCoefficients.resize(std::min(numCoefficients, (int)Blendshapes::BlendshapeCount));  // make sure there's room for the copy!
         //only copy the blendshapes to headData, not the procedural face info
         memcpy(_headData->_blendshapeCoefficients.data(), sourceBuffer, coefficientsSize);
         sourceBuffer += coefficientsSize;
 
+        if (blendshapesChanged) {
+            // stamp the change so per-receiver broadcasts can omit an unchanged face tracker section
+            _headData->markBlendshapesChanged();
+        }
+
         int numBytesRead = sourceBuffer - startSection;
         _faceTrackerRate.increment(numBytesRead);
         _faceTrackerUpdateRate.increment();
@@ -1353,10 +1378,17 @@ int AvatarData::parseDataFromBuffer(const QByteArray& buffer) {
 
         const int COMPRESSED_QUATERNION_SIZE = 6;
         PACKET_READ_CHECK(JointRotations, numValidJointRotations * COMPRESSED_QUATERNION_SIZE);
+
+        // the packed rotations are contiguous, so decode the whole skeleton in one
+        // structure-of-arrays batch and scatter the results to the valid joints
+        glm::quat unpackedRotations[UINT8_MAX];  // numJoints is read from a byte
+        sourceBuffer += unpackOrientationQuatsFromSixBytes(sourceBuffer, unpackedRotations, numValidJointRotations);
+
+        int rotationIndex = 0;
         for (int i = 0; i < numJoints; i++) {
             JointData& data = _jointData[i];
             if (validRotations[i]) {
-                sourceBuffer += unpackOrientationQuatFromSixBytes(sourceBuffer, data.rotation);
+                data.rotation = unpackedRotations[rotationIndex++];
                 _hasNewJointData = true;
                 data.rotationIsDefaultPose = false;
             }
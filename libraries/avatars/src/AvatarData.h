@@ -1694,7 +1694,7 @@ protected:
     bool sensorToWorldMatrixChangedSince(quint64 time) const { return _sensorToWorldMatrixChanged >= time; }
     bool additionalFlagsChangedSince(quint64 time) const { return _additionalFlagsChanged >= time; }
     bool parentInfoChangedSince(quint64 time) const { return _parentChanged >= time; }
-    bool faceTrackerInfoChangedSince(quint64 time) const { return true; } // FIXME
+    bool faceTrackerInfoChangedSince(quint64 time) const { return _headData->blendshapesChangedSince(time); }
 
     bool hasParent() const { return !getParentID().isNull(); }
 
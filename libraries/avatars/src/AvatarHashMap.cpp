@@ -13,6 +13,7 @@
 
 #include <QtCore/QDataStream>
 
+#include <Gzip.h>
 #include <NodeList.h>
 #include <udt/PacketHeaders.h>
 #include <PerfStat.h>
@@ -217,6 +218,7 @@ AvatarSharedPointer AvatarHashMap::addAvatar(const QUuid& sessionUUID, const QWe
     {
         QWriteLocker locker(&_hashLock);
         _avatarHash.insert(sessionUUID, avatar);
+        publishAvatarHashSnapshot();
     }
     emit avatarAddedEvent(sessionUUID);
     return avatar;
@@ -340,6 +342,28 @@ void AvatarHashMap::processAvatarIdentityPacket(QSharedPointer<ReceivedMessage>
 }
 
 void AvatarHashMap::processBulkAvatarTraits(QSharedPointer<ReceivedMessage> message, SharedNodePointer sendingNode) {
+    // the message arrives in a (compressed-flag, payload) envelope
+    if (message->getBytesLeftToRead() < (qint64)sizeof(quint8)) {
+        qWarning() << "Malformed bulk trait packet, bailling";
+        return;
+    }
+
+    quint8 compressedFlag = 0;
+    message->readPrimitive(&compressedFlag);
+
+    QByteArray traitsPayload = message->read(message->getBytesLeftToRead());
+    if (compressedFlag) {
+        QByteArray expandedPayload;
+        if (!gunzip(traitsPayload, expandedPayload)) {
+            qWarning() << "Unable to decompress bulk trait packet, bailling";
+            return;
+        }
+        traitsPayload = expandedPayload;
+    }
+
+    message = QSharedPointer<ReceivedMessage>::create(traitsPayload, message->getType(), message->getVersion(),
+                                                      message->getSenderSockAddr(), message->getSourceID());
+
     AvatarTraits::TraitMessageSequence seq;
 
     // Trying to read more bytes than available, bail
@@ -497,6 +521,8 @@ void AvatarHashMap::removeAvatar(const QUuid& sessionUUID, KillAvatarReason remo
         if (removedAvatar) {
             removedAvatars.push_back(removedAvatar);
         }
+
+        publishAvatarHashSnapshot();
     }
 
     for (auto& removedAvatar: removedAvatars) {
@@ -528,6 +554,7 @@ void AvatarHashMap::clearOtherAvatars() {
         removedAvatars = _avatarHash.values();
 
         _avatarHash.clear();
+        publishAvatarHashSnapshot();
     }
 
     for (auto& av : removedAvatars) {
@@ -74,9 +74,11 @@ class AvatarHashMap : public QObject, public Dependency {
     SINGLETON_DEPENDENCY
 
 public:
-    AvatarHash getHashCopy() { QReadLocker lock(&_hashLock); return _avatarHash; }
-    const AvatarHash getHashCopy() const { QReadLocker lock(&_hashLock); return _avatarHash; }
-    int size() { QReadLocker lock(&_hashLock); return _avatarHash.size(); }
+    // per-frame readers (render, physics, scripts) take a lock-free snapshot; writers
+    // republish it after each mutation, so the hash lock is only ever touched by writers
+    AvatarHash getHashCopy() { return *std::atomic_load(&_avatarHashSnapshot); }
+    const AvatarHash getHashCopy() const { return *std::atomic_load(&_avatarHashSnapshot); }
+    int size() { return (int)std::atomic_load(&_avatarHashSnapshot)->size(); }
 
     // Currently, your own avatar will be included as the null avatar id.
     
@@ -236,8 +238,15 @@ protected:
     
     virtual void handleRemovedAvatar(const AvatarSharedPointer& removedAvatar, KillAvatarReason removalReason = KillAvatarReason::NoReason);
     
+    // republish the read-only snapshot; call with _hashLock held for write
+    // after every mutation of _avatarHash
+    void publishAvatarHashSnapshot() {
+        std::atomic_store(&_avatarHashSnapshot, std::make_shared<const AvatarHash>(_avatarHash));
+    }
+
     mutable QReadWriteLock _hashLock;
     AvatarHash _avatarHash;
+    std::shared_ptr<const AvatarHash> _avatarHashSnapshot { std::make_shared<const AvatarHash>() };
 
     std::unordered_map<QUuid, AvatarTraits::TraitVersions> _processedTraitVersions;
     AvatarReplicas _replicas;
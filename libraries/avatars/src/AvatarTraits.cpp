@@ -38,9 +38,7 @@ namespace AvatarTraits {
     }
 
     qint64 packVersionedTrait(TraitType traitType, ExtendedIODevice& destination,
-                              TraitVersion traitVersion, const AvatarData& avatar) {
-        // Call packer function
-        auto traitBinaryData = avatar.packTrait(traitType);
+                              TraitVersion traitVersion, const QByteArray& traitBinaryData) {
         auto traitBinaryDataSize = traitBinaryData.size();
 
         // Verify packed data
@@ -59,6 +57,11 @@ namespace AvatarTraits {
         return bytesWritten;
     }
 
+    qint64 packVersionedTrait(TraitType traitType, ExtendedIODevice& destination,
+                              TraitVersion traitVersion, const AvatarData& avatar) {
+        return packVersionedTrait(traitType, destination, traitVersion, avatar.packTrait(traitType));
+    }
+
 
     qint64 packTraitInstance(TraitType traitType, TraitInstanceID traitInstanceID,
                              ExtendedIODevice& destination, AvatarData& avatar) {
@@ -62,6 +62,12 @@ namespace AvatarTraits {
     const TraitMessageSequence MAX_TRAIT_SEQUENCE = INT64_MAX;
 
     qint64 packTrait(TraitType traitType, ExtendedIODevice& destination, const AvatarData& avatar);
+
+    // variant taking an already packed payload, so one immutable buffer can be
+    // shared by reference across every receiver's packet list
+    qint64 packVersionedTrait(TraitType traitType, ExtendedIODevice& destination,
+                              TraitVersion traitVersion, const QByteArray& traitBinaryData);
+
     qint64 packVersionedTrait(TraitType traitType, ExtendedIODevice& destination,
                               TraitVersion traitVersion, const AvatarData& avatar);
 
@@ -78,6 +78,7 @@ int HeadData::getNumSummedBlendshapeCoefficients() const {
 
 void HeadData::clearBlendshapeCoefficients() {
     _blendshapeCoefficients.fill(0.0f, (int)_blendshapeCoefficients.size());
+    markBlendshapesChanged();
 }
 
 const QVector<float>& HeadData::getSummedBlendshapeCoefficients() {
@@ -110,6 +111,9 @@ void HeadData::setBlendshape(QString name, float val) {
         if (_transientBlendshapeCoefficients.size() <= it.value()) {
             _transientBlendshapeCoefficients.resize(it.value() + 1);
         }
+        if (_blendshapeCoefficients[it.value()] != val) {
+            markBlendshapesChanged();
+        }
         _blendshapeCoefficients[it.value()] = val;
     } else {
         // check to see if this is a legacy blendshape that is present in
@@ -124,6 +128,7 @@ void HeadData::setBlendshape(QString name, float val) {
             _blendshapeCoefficients[(int)Blendshapes::NoseSneer_L] = val;
             _blendshapeCoefficients[(int)Blendshapes::NoseSneer_R] = val;
         }
+        markBlendshapesChanged();
     }
 }
 
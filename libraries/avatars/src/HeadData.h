@@ -61,9 +61,17 @@ public:
     const QVector<float>& getBlendshapeCoefficients() const { return _blendshapeCoefficients; }
     const QVector<float>& getSummedBlendshapeCoefficients();
     int getNumSummedBlendshapeCoefficients() const;
-    void setBlendshapeCoefficients(const QVector<float>& blendshapeCoefficients) { _blendshapeCoefficients = blendshapeCoefficients; }
+    void setBlendshapeCoefficients(const QVector<float>& blendshapeCoefficients) {
+        if (_blendshapeCoefficients != blendshapeCoefficients) {
+            markBlendshapesChanged();
+        }
+        _blendshapeCoefficients = blendshapeCoefficients;
+    }
     void clearBlendshapeCoefficients();
 
+    void markBlendshapesChanged() { _blendshapesChanged = usecTimestampNow(); }
+    bool blendshapesChangedSince(quint64 time) const { return _blendshapesChanged >= time; }
+
     const glm::vec3& getLookAtPosition() const { return _lookAtPosition; }
     virtual void setLookAtPosition(const glm::vec3& lookAtPosition) {
         if (_lookAtPosition != lookAtPosition) {
@@ -110,6 +118,7 @@ protected:
 
     glm::vec3 _lookAtPosition;
     quint64 _lookAtPositionChanged { 0 };
+    quint64 _blendshapesChanged { 0 };
 
     std::vector<bool> _userProceduralAnimationFlags;
     std::vector<bool> _suppressProceduralAnimationFlags;
@@ -223,19 +223,15 @@ void TextureBaker::processTexture() {
             return;
         }
 
-        auto memKTX = gpu::Texture::serialize(*processedTextureAndSize.first, processedTextureAndSize.second);
-        if (!memKTX) {
-            handleError("Could not serialize " + _textureURL.toString() + " to KTX");
-            return;
-        }
-
-        const char* data = reinterpret_cast<const char*>(memKTX->_storage->data());
-        const size_t length = memKTX->_storage->size();
-
         auto fileName = _baseFilename + ".ktx";
         auto filePath = _outputDirectory.absoluteFilePath(fileName);
-        QFile bakedTextureFile { filePath };
-        if (!bakedTextureFile.open(QIODevice::WriteOnly) || bakedTextureFile.write(data, length) == -1) {
+
+        // serialize straight into the mapped output file: uncompressed skybox and
+        // ambient cube maps are the largest bakes, and the in-memory staging copy
+        // is what blows up batch-bake memory
+        auto fileKTX = gpu::Texture::serializeToKTXFile(*processedTextureAndSize.first, processedTextureAndSize.second,
+                                                        filePath.toStdString());
+        if (!fileKTX) {
             handleError("Could not write baked texture for " + _textureURL.toString());
             return;
         }
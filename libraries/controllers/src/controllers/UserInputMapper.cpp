@@ -96,6 +96,7 @@ void UserInputMapper::registerDevice(InputDevice::Pointer device) {
     }
 
     _registeredDevices[deviceID] = device;
+    _standardEndpointScanDirty = true;
 
     auto mapping = loadMappings(device->getDefaultMappingConfigs());
     if (mapping) {
@@ -138,6 +139,7 @@ void UserInputMapper::removeDevice(int deviceID) {
     }
 
     _registeredDevices.erase(proxyEntry);
+    _standardEndpointScanDirty = true;
 
     emit hardwareChanged();
 }
@@ -289,17 +291,24 @@ void UserInputMapper::update(float deltaTime) {
         // TODO: emit signal for pose changes
     }
 
-    auto standardInputs = getStandardInputs();
-    if ((int)_lastStandardStates.size() != standardInputs.size()) {
-        _lastStandardStates.resize(standardInputs.size());
-        for (auto& lastValue : _lastStandardStates) {
-            lastValue = AxisValue();
+    // the standard device's input set only changes when devices are registered or
+    // removed, so sweep a cached flat scan list instead of rebuilding the named
+    // input vector and re-resolving each endpoint through the map every frame
+    if (_standardEndpointScanDirty) {
+        _standardEndpointScan.clear();
+        for (const auto& inputPair : getStandardInputs()) {
+            auto entry = _endpointsByInput.find(inputPair.first);
+            if (entry != _endpointsByInput.end()) {
+                _standardEndpointScan.emplace_back(inputPair.first, entry->second);
+            }
         }
+        _lastStandardStates.assign(_standardEndpointScan.size(), AxisValue());
+        _standardEndpointScanDirty = false;
     }
 
-    for (int i = 0; i < standardInputs.size(); ++i) {
-        const auto& input = standardInputs[i].first;
-        AxisValue value = getValue(input);
+    for (size_t i = 0; i < _standardEndpointScan.size(); ++i) {
+        const auto& input = _standardEndpointScan[i].first;
+        AxisValue value = getValue(_standardEndpointScan[i].second);
         AxisValue& oldValue = _lastStandardStates[i];
         if (value != oldValue) {
             oldValue = value;
@@ -150,6 +150,11 @@ namespace controller {
         std::vector<bool> _actionStatesValid = std::vector<bool>(toInt(Action::NUM_ACTIONS), false);
         std::vector<Pose> _poseStates = std::vector<Pose>(toInt(Action::NUM_ACTIONS));
         std::vector<AxisValue> _lastStandardStates = std::vector<AxisValue>();
+        // flat scan list of the standard device's endpoints, rebuilt when devices
+        // change, so the per-frame standard input sweep is one pass over contiguous
+        // entries instead of a name-vector rebuild and a locked lookup per input
+        std::vector<std::pair<Input, EndpointPointer>> _standardEndpointScan;
+        bool _standardEndpointScanDirty { true };
 
         static AxisValue getValue(const EndpointPointer& endpoint, bool peek = false);
         static Pose getPose(const EndpointPointer& endpoint, bool peek = false);
@@ -692,6 +692,8 @@ void OpenGLDisplayPlugin::present(const std::shared_ptr<RefreshRateController>&
     auto frameId = (uint64_t)presentCount();
     PROFILE_RANGE_EX(render, __FUNCTION__, 0xffffff00, frameId)
     uint64_t startPresent = usecTimestampNow();
+    FramePacingSample pacingSample;
+    pacingSample.presentStart = startPresent;
     refreshRateController->clockStartTime();
     {
         PROFILE_RANGE_EX(render, "updateFrameData", 0xff00ff00, frameId)
@@ -715,12 +717,14 @@ void OpenGLDisplayPlugin::present(const std::shared_ptr<RefreshRateController>&
             PROFILE_RANGE_EX(render, "execute", 0xff00ff00, frameId)
             _gpuContext->executeFrame(_currentFrame);
         }
+        pacingSample.executeDone = usecTimestampNow();
 
         // Write all layers to a local framebuffer
         {
             PROFILE_RANGE_EX(render, "composite", 0xff00ffff, frameId)
             compositeLayers();
         }
+        pacingSample.compositeDone = usecTimestampNow();
 
         { // If we have any snapshots this frame, handle them
             PROFILE_RANGE_EX(render, "snapshotOperators", 0xffff00ff, frameId)
@@ -741,6 +745,8 @@ void OpenGLDisplayPlugin::present(const std::shared_ptr<RefreshRateController>&
             PROFILE_RANGE_EX(render, "internalPresent", 0xff00ffff, frameId)
             internalPresent();
         }
+        pacingSample.presentDone = usecTimestampNow();
+        _pacingSamples[_pacingSampleIndex++ % PACING_SAMPLE_COUNT] = pacingSample;
 
         gpu::Backend::freeGPUMemSize.set(gpu::gl::getFreeDedicatedMemory());
     } else if (alwaysPresent()) {
@@ -752,6 +758,39 @@ void OpenGLDisplayPlugin::present(const std::shared_ptr<RefreshRateController>&
     _movingAveragePresent.addSample((float)(usecTimestampNow() - startPresent));
 }
 
+QJsonObject OpenGLDisplayPlugin::getHardwareStats() const {
+    // averaged over the pacing ring; samples are written by the present thread
+    // without synchronization, so a torn sample can perturb one entry - acceptable
+    // for telemetry that is itself an average
+    uint64_t executeTotal = 0, compositeTotal = 0, submitTotal = 0, frameTotal = 0;
+    uint64_t frameMax = 0;
+    int count = 0;
+    for (int i = 0; i < PACING_SAMPLE_COUNT; i++) {
+        const auto& sample = _pacingSamples[i];
+        if (sample.presentDone == 0 || sample.executeDone < sample.presentStart ||
+            sample.compositeDone < sample.executeDone || sample.presentDone < sample.compositeDone) {
+            continue;
+        }
+        executeTotal += sample.executeDone - sample.presentStart;
+        compositeTotal += sample.compositeDone - sample.executeDone;
+        submitTotal += sample.presentDone - sample.compositeDone;
+        uint64_t frameUsecs = sample.presentDone - sample.presentStart;
+        frameTotal += frameUsecs;
+        frameMax = std::max(frameMax, frameUsecs);
+        ++count;
+    }
+
+    QJsonObject hardwareStats;
+    if (count > 0) {
+        hardwareStats["frame_execute_usecs_avg"] = (qint64)(executeTotal / count);
+        hardwareStats["frame_composite_usecs_avg"] = (qint64)(compositeTotal / count);
+        hardwareStats["frame_submit_usecs_avg"] = (qint64)(submitTotal / count);
+        hardwareStats["frame_present_usecs_avg"] = (qint64)(frameTotal / count);
+        hardwareStats["frame_present_usecs_max"] = (qint64)frameMax;
+    }
+    return hardwareStats;
+}
+
 float OpenGLDisplayPlugin::newFramePresentRate() const {
     return _newFrameRate.rate();
 }
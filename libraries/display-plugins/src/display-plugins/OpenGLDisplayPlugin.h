@@ -9,6 +9,7 @@
 
 #include "DisplayPlugin.h"
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <queue>
@@ -72,6 +73,8 @@ public:
 
     float renderRate() const override;
 
+    QJsonObject getHardwareStats() const override;
+
     bool beginFrameRender(uint32_t frameIndex) override;
 
     virtual bool wantVsync() const { return true; }
@@ -148,6 +151,18 @@ protected:
     RateCounter<200> _presentRate;
     RateCounter<200> _renderRate;
 
+    // per-frame pacing samples captured by present(), to separate app-side misses
+    // (execute/composite overruns) from compositor/driver-side misses (submit stalls)
+    struct FramePacingSample {
+        uint64_t presentStart { 0 };    // present() entry
+        uint64_t executeDone { 0 };     // frame render commands executed
+        uint64_t compositeDone { 0 };   // layers composited
+        uint64_t presentDone { 0 };     // internalPresent returned
+    };
+    static const int PACING_SAMPLE_COUNT = 128;
+    FramePacingSample _pacingSamples[PACING_SAMPLE_COUNT];
+    std::atomic<uint64_t> _pacingSampleIndex { 0 };
+
     gpu::FramePointer _currentFrame;
     gpu::Frame* _lastFrame{ nullptr };
     mat4 _prevRenderView;
@@ -25,6 +25,7 @@ const char* HTTPConnection::StatusCode200 = "200 OK";
 const char* HTTPConnection::StatusCode204 = "204 No Content";
 const char* HTTPConnection::StatusCode301 = "301 Moved Permanently";
 const char* HTTPConnection::StatusCode302 = "302 Found";
+const char* HTTPConnection::StatusCode304 = "304 Not Modified";
 const char* HTTPConnection::StatusCode400 = "400 Bad Request";
 const char* HTTPConnection::StatusCode401 = "401 Unauthorized";
 const char* HTTPConnection::StatusCode403 = "403 Forbidden";
@@ -48,6 +48,7 @@ public:
     static const char* StatusCode204;
     static const char* StatusCode301;
     static const char* StatusCode302;
+    static const char* StatusCode304;
     static const char* StatusCode400;
     static const char* StatusCode401;
     static const char* StatusCode403;
@@ -12,6 +12,7 @@
 #include "HTTPManager.h"
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
 #include <QtCore/QDebug>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
@@ -116,12 +117,26 @@ bool HTTPManager::handleHTTPRequest(HTTPConnection* connection, const QUrl& url,
             // file exists, serve it
             static QMimeDatabase mimeDatabase;
 
+            QFileInfo localFileInfo(filePath);
+
+            // a weak ETag from size and mtime lets browsers revalidate the
+            // settings UI's many small assets without re-downloading them.
+            // shtml is excluded: its body depends on SSI-included files whose
+            // changes this tag wouldn't see
+            bool canBeConditional = localFileInfo.completeSuffix() != "shtml";
+            QByteArray entityTag = "\"" + QByteArray::number(localFileInfo.size()) + "-"
+                + QByteArray::number(localFileInfo.lastModified().toMSecsSinceEpoch()) + "\"";
+            if (canBeConditional && connection->requestHeader("If-None-Match") == entityTag) {
+                HTTPConnection::Headers notModifiedHeaders;
+                notModifiedHeaders.insert("ETag", entityTag);
+                connection->respond(HTTPConnection::StatusCode304, "", HTTPConnection::DefaultContentType, notModifiedHeaders);
+                return true;
+            }
+
             auto localFile = std::unique_ptr<QFile>(new QFile(filePath));
             localFile->open(QIODevice::ReadOnly);
             QByteArray localFileData;
 
-            QFileInfo localFileInfo(filePath);
-
             if (localFileInfo.completeSuffix() == "shtml") {
                 localFileData = localFile->readAll();
                 // this is a file that may have some SSI statements
@@ -173,10 +188,15 @@ bool HTTPManager::handleHTTPRequest(HTTPConnection* connection, const QUrl& url,
                 ? QString { "text/html" }
                 : mimeDatabase.mimeTypeForFile(filePath).name();
 
+            HTTPConnection::Headers fileHeaders;
+            if (canBeConditional) {
+                fileHeaders.insert("ETag", entityTag);
+            }
+
             if (localFileData.isNull()) {
-                connection->respond(HTTPConnection::StatusCode200, std::move(localFile), qPrintable(mimeType));
+                connection->respond(HTTPConnection::StatusCode200, std::move(localFile), qPrintable(mimeType), fileHeaders);
             } else {
-                connection->respond(HTTPConnection::StatusCode200, localFileData, qPrintable(mimeType));
+                connection->respond(HTTPConnection::StatusCode200, localFileData, qPrintable(mimeType), fileHeaders);
             }
 
             return true;
@@ -446,12 +446,13 @@ void EntityTreeRenderer::addPendingEntities(const render::ScenePointer& scene, r
 }
 
 void EntityTreeRenderer::updateChangedEntities(const render::ScenePointer& scene, render::Transaction& transaction) {
-    PROFILE_RANGE_EX(simulation_physics, "ChangeInScene", 0xffff00ff, (uint64_t)_changedEntities.size());
     PerformanceTimer pt("change");
     std::unordered_set<EntityItemID> changedEntities;
-    _changedEntitiesGuard.withWriteLock([&] {
-        changedEntities.swap(_changedEntities);
-    });
+    EntityItemID changedId;
+    while (_changedEntitiesQueue.try_pop(changedId)) {
+        changedEntities.insert(changedId);
+    }
+    PROFILE_RANGE_EX(simulation_physics, "ChangeInScene", 0xffff00ff, (uint64_t)changedEntities.size());
 
     {
         PROFILE_RANGE_EX(simulation_physics, "CopyRenderables", 0xffff00ff, (uint64_t)changedEntities.size());
@@ -1194,6 +1195,29 @@ void EntityTreeRenderer::playEntityCollisionSound(const EntityItemPointer& entit
     DependencyManager::get<AudioInjectorManager>()->playSound(collisionSound, options, true);
 }
 
+bool EntityTreeRenderer::shouldEmitCollisionScriptEvent(const EntityItemID& entityID, const Collision& collision, uint64_t now) {
+    // start and end events always reach scripts; "continue" events for a given entity
+    // are capped so a pile-up of persistent contacts can't flood the script thread
+    if (collision.type != CONTACT_EVENT_TYPE_CONTINUE) {
+        return true;
+    }
+
+    const uint64_t MIN_CONTINUE_EVENT_INTERVAL = USECS_PER_SECOND / 20;   // per-entity 20Hz cap
+
+    // amnesty rather than bookkeeping: reset the table if it ever grows large
+    const size_t MAX_TRACKED_COLLIDING_ENTITIES = 4096;
+    if (_lastCollisionScriptEventTimes.size() > MAX_TRACKED_COLLIDING_ENTITIES) {
+        _lastCollisionScriptEventTimes.clear();
+    }
+
+    uint64_t& lastTime = _lastCollisionScriptEventTimes[entityID];
+    if (now - lastTime < MIN_CONTINUE_EVENT_INTERVAL) {
+        return false;
+    }
+    lastTime = now;
+    return true;
+}
+
 void EntityTreeRenderer::entityCollisionWithEntity(const EntityItemID& idA, const EntityItemID& idB,
                                                     const Collision& collision) {
     // If we don't have a tree, or we're in the process of shutting down, then don't
@@ -1224,12 +1248,16 @@ void EntityTreeRenderer::entityCollisionWithEntity(const EntityItemID& idA, cons
         assert(!bothEntitiesStatic);
 #endif
 
+        uint64_t now = usecTimestampNow();
+
         if ((myNodeID == entityASimulatorID && entityAIsDynamic) || (myNodeID == entityBSimulatorID && (!entityAIsDynamic || entityASimulatorID.isNull()))) {
             playEntityCollisionSound(entityA, collision);
-            emit collisionWithEntity(idA, idB, collision);
-            auto& scriptEngine = (entityA->isLocalEntity() || entityA->isMyAvatarEntity()) ? _persistentEntitiesScriptEngine : _nonPersistentEntitiesScriptEngine;
-            if (scriptEngine) {
-                scriptEngine->callEntityScriptMethod(idA, "collisionWithEntity", idB, collision);
+            if (shouldEmitCollisionScriptEvent(idA, collision, now)) {
+                emit collisionWithEntity(idA, idB, collision);
+                auto& scriptEngine = (entityA->isLocalEntity() || entityA->isMyAvatarEntity()) ? _persistentEntitiesScriptEngine : _nonPersistentEntitiesScriptEngine;
+                if (scriptEngine) {
+                    scriptEngine->callEntityScriptMethod(idA, "collisionWithEntity", idB, collision);
+                }
             }
         }
 
@@ -1238,10 +1266,12 @@ void EntityTreeRenderer::entityCollisionWithEntity(const EntityItemID& idA, cons
             // since we're swapping A and B we need to send the inverted collision
             Collision invertedCollision(collision);
             invertedCollision.invert();
-            emit collisionWithEntity(idB, idA, invertedCollision);
-            auto& scriptEngine = (entityB->isLocalEntity() || entityB->isMyAvatarEntity()) ? _persistentEntitiesScriptEngine : _nonPersistentEntitiesScriptEngine;
-            if (scriptEngine) {
-                scriptEngine->callEntityScriptMethod(idB, "collisionWithEntity", idA, invertedCollision);
+            if (shouldEmitCollisionScriptEvent(idB, collision, now)) {
+                emit collisionWithEntity(idB, idA, invertedCollision);
+                auto& scriptEngine = (entityB->isLocalEntity() || entityB->isMyAvatarEntity()) ? _persistentEntitiesScriptEngine : _nonPersistentEntitiesScriptEngine;
+                if (scriptEngine) {
+                    scriptEngine->callEntityScriptMethod(idB, "collisionWithEntity", idA, invertedCollision);
+                }
             }
         }
     }
@@ -1430,9 +1460,9 @@ void EntityTreeRenderer::deleteEntity(const EntityItemID& id) const {
 }
 
 void EntityTreeRenderer::onEntityChanged(const EntityItemID& id) {
-    _changedEntitiesGuard.withWriteLock([&] {
-        _changedEntities.insert(id);
-    });
+    // any thread may report a change; the queue is drained and deduplicated in
+    // updateChangedEntities
+    _changedEntitiesQueue.push(id);
 }
 
 EntityEditPacketSender* EntityTreeRenderer::getPacketSender() {
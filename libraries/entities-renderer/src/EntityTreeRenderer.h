@@ -22,6 +22,7 @@
 #include <AudioInjectorManager.h>
 #include <EntityScriptingInterface.h> // for RayToEntityIntersectionResult
 #include <EntityTree.h>
+#include <TBBHelpers.h>
 #include <PointerEvent.h>
 #include <ScriptCache.h>
 #include <TextureCache.h>
@@ -253,12 +254,16 @@ private:
     LayeredZones _layeredZones;
     uint64_t _lastZoneCheck { 0 };
     const uint64_t ZONE_CHECK_INTERVAL = USECS_PER_MSEC * 100; // ~10hz
-    const float ZONE_CHECK_DISTANCE = 0.001f;
+    // below this much movement the 10hz interval above drives the re-check; the
+    // old 1mm threshold was inside HMD jitter, so VR ran the full containment
+    // scan every frame. A slow boundary crossing is still caught within the
+    // interval.
+    const float ZONE_CHECK_DISTANCE = 0.05f;
 
     float _avgRenderableUpdateCost { 0.0f };
 
-    ReadWriteLockable _changedEntitiesGuard;
-    std::unordered_set<EntityItemID> _changedEntities;
+    // lock-free MPSC handoff of change notifications; deduplicated when drained
+    tbb::concurrent_queue<EntityItemID> _changedEntitiesQueue;
     size_t _prevNumEntityUpdates { 0 };
     size_t _prevTotalNeededEntityUpdates { 0 };
 
@@ -269,6 +274,10 @@ private:
     // For Scene.shouldRenderEntities
     QList<EntityItemID> _entityIDsLastInScene;
 
+    // per-entity cap on "continue" collision script events; see shouldEmitCollisionScriptEvent
+    bool shouldEmitCollisionScriptEvent(const EntityItemID& entityID, const Collision& collision, uint64_t now);
+    std::unordered_map<EntityItemID, uint64_t> _lastCollisionScriptEventTimes;
+
     static int _entitiesScriptEngineCount;
     static CalculateEntityLoadingPriority _calculateEntityLoadingPriorityFunc;
     static std::function<bool()> _entitiesShouldFadeFunction;
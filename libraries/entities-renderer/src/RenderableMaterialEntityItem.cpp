@@ -8,6 +8,8 @@
 
 #include "RenderableMaterialEntityItem.h"
 
+#include <QtCore/QCache>
+
 #include "RenderPipelines.h"
 #include "GeometryCache.h"
 
@@ -185,7 +187,27 @@ void MaterialEntityRenderer::doRenderUpdateAsynchronousTyped(const TypedEntityPo
     } else if (materialDataChanged && usingMaterialData) {
         deleteMaterial(oldParentID, oldParentMaterialName);
         _texturesLoaded = false;
-        _parsedMaterials = NetworkMaterialResource::parseJSONMaterials(QJsonDocument::fromJson(_materialData.toUtf8()), _materialURL);
+        // identical inline materialData across entities parses once; the cache
+        // holds a pristine parse and each entity gets its own clones of the
+        // NetworkMaterials, because applyMaterial writes per-entity state into
+        // them (texture transforms, procedural bound operators)
+        static QCache<QString, NetworkMaterialResource::ParsedMaterials> parsedMaterialDataCache(128);
+        QString parsedCacheKey = _materialURL + QChar('\x1f') + _materialData;
+        NetworkMaterialResource::ParsedMaterials pristineParse;
+        if (auto* cachedParse = parsedMaterialDataCache.object(parsedCacheKey)) {
+            pristineParse = *cachedParse;
+        } else {
+            pristineParse = NetworkMaterialResource::parseJSONMaterials(QJsonDocument::fromJson(_materialData.toUtf8()), _materialURL);
+            parsedMaterialDataCache.insert(parsedCacheKey, new NetworkMaterialResource::ParsedMaterials(pristineParse));
+        }
+
+        _parsedMaterials.reset();
+        _parsedMaterials.version = pristineParse.version;
+        _parsedMaterials.names = pristineParse.names;
+        for (const auto& parsedMaterial : pristineParse.networkMaterials) {
+            _parsedMaterials.networkMaterials[parsedMaterial.first] =
+                std::make_shared<NetworkMaterial>(*parsedMaterial.second);
+        }
         // Since our material changed, the current name might not be valid anymore, so we need to update
         setCurrentMaterialName(newCurrentMaterialName);
         applyMaterial(entity);
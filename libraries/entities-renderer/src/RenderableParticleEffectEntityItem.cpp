@@ -372,6 +372,15 @@ void ParticleEffectEntityRenderer::stepSimulation() {
     const auto interval = std::min<uint64_t>(USECS_PER_SECOND / 60, now - _lastSimulated);
     _lastSimulated = now;
 
+    // idle emitter with no live particles and an already-empty buffer: nothing to
+    // integrate, transform, or upload this frame
+    if (_cpuParticles.empty() && !(_emitting && _particleProperties.emitting()) && _particleBuffer->getSize() == 0) {
+        // keep the trail-mode memory in sync so a toggle while idle doesn't
+        // trigger a spurious rebase on the first active frame
+        _prevEmitterShouldTrail = _particleProperties.emission.shouldTrail;
+        return;
+    }
+
     const auto& modelTransform = getModelTransform();
     if (_emitting && _particleProperties.emitting() &&
         (_shapeType != SHAPE_TYPE_COMPOUND || (_geometryResource && _geometryResource->isLoaded()))) {
@@ -400,14 +409,18 @@ void ParticleEffectEntityRenderer::stepSimulation() {
     }
 
     const float deltaTime = (float)interval / (float)USECS_PER_SECOND;
-    // update the particles
-    for (auto& particle : _cpuParticles) {
-        if (_prevEmitterShouldTrail != _particleProperties.emission.shouldTrail) {
+    // update the particles; the trail-mode rebase applies only on the frame the
+    // emitter setting flips, so test it once rather than per particle
+    bool trailModeChanged = _prevEmitterShouldTrail != _particleProperties.emission.shouldTrail;
+    if (trailModeChanged) {
+        for (auto& particle : _cpuParticles) {
             if (_prevEmitterShouldTrail) {
                 particle.relativePosition = particle.relativePosition + particle.basePosition - modelTransform.getTranslation();
             }
             particle.basePosition = modelTransform.getTranslation();
         }
+    }
+    for (auto& particle : _cpuParticles) {
         particle.expiration = particle.expiration >= interval ? particle.expiration - interval : 0;
         particle.integrate(deltaTime);
     }
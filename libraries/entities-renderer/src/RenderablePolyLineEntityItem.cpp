@@ -295,7 +295,22 @@ void PolyLineEntityRenderer::updateGeometry() {
     }
 
     _numVertices = vertices.size();
-    _polylineGeometryBuffer->setData(vertices.size() * sizeof(PolylineVertex), (const gpu::Byte*) vertices.data());
+    size_t numBytes = vertices.size() * sizeof(PolylineVertex);
+    if (numBytes == 0) {
+        return;
+    }
+    if (numBytes <= _polylineGeometryBuffer->getSize()) {
+        // common case for active drawing (a point appended or moved): patch the
+        // existing allocation so the backend syncs a dirty range instead of
+        // recreating the buffer at every update
+        _polylineGeometryBuffer->setSubData(0, numBytes, (const gpu::Byte*) vertices.data());
+    } else {
+        // grow with headroom so a stroke being drawn doesn't reallocate on
+        // every appended point; draws are bounded by _numVertices, not the
+        // buffer size, so the spare tail is inert
+        _polylineGeometryBuffer->resize(numBytes * 2);
+        _polylineGeometryBuffer->setSubData(0, numBytes, (const gpu::Byte*) vertices.data());
+    }
 }
 
 void PolyLineEntityRenderer::updateData() {
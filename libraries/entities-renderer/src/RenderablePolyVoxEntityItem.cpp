@@ -337,9 +337,12 @@ bool RenderablePolyVoxEntityItem::setSphereInVolume(const vec3& center, float ra
     }
 
     float radiusSquared = radius * radius;
-    // This three-level for loop iterates over every voxel in the volume
+    // only visit voxels inside the sphere's bounding box - an edit brush shouldn't
+    // cost a walk of the whole volume
     withWriteLock([&] {
-        loop3(ivec3(0), ivec3(_voxelVolumeSize), [&](const ivec3& v) {
+        ivec3 low = glm::max(ivec3(glm::floor(center - radius)), ivec3(0));
+        ivec3 high = glm::min(ivec3(glm::ceil(center + radius)) + ivec3(1), ivec3(_voxelVolumeSize));
+        loop3(low, high, [&](const ivec3& v) {
             // Store our current position as a vector...
             glm::vec3 pos = vec3(v) + 0.5f; // consider voxels cenetered on their coordinates
             // And compute how far the current position is from the center of the volume
@@ -51,6 +51,11 @@ static float OPAQUE_ALPHA_THRESHOLD = 0.99f;
 // If a web-view hasn't been rendered for 30 seconds, de-allocate the framebuffer
 static uint64_t MAX_NO_RENDER_INTERVAL = 30 * USECS_PER_SECOND;
 
+// If a web-view hasn't been rendered for 2 seconds (out of view), drop its surface
+// to an idle rate until it renders again
+static uint64_t IDLE_RENDER_INTERVAL = 2 * USECS_PER_SECOND;
+static uint8_t IDLE_MAX_FPS = 5;
+
 static uint8_t YOUTUBE_MAX_FPS = 30;
 
 // Don't allow more than 20 concurrent web views
@@ -135,11 +140,27 @@ void WebEntityRenderer::onTimeout() {
         return;
     }
 
-    if (usecTimestampNow() - lastRenderTime > MAX_NO_RENDER_INTERVAL) {
+    uint64_t sinceLastRender = usecTimestampNow() - lastRenderTime;
+    if (sinceLastRender > MAX_NO_RENDER_INTERVAL) {
         destroyWebSurface();
+    } else if (sinceLastRender > IDLE_RENDER_INTERVAL) {
+        withWriteLock([&] {
+            if (!_idleThrottled && _webSurface) {
+                _webSurface->setMaxFps(IDLE_MAX_FPS);
+                _idleThrottled = true;
+            }
+        });
     }
 }
 
+uint8_t WebEntityRenderer::currentMaxFPS() const {
+    // matches the YouTube special case applied when the URL or maxFPS property changes
+    if (QUrl(_sourceURL).host().endsWith("youtube.com", Qt::CaseInsensitive)) {
+        return YOUTUBE_MAX_FPS;
+    }
+    return _maxFPS;
+}
+
 void WebEntityRenderer::doRenderUpdateSynchronousTyped(const ScenePointer& scene, Transaction& transaction, const TypedEntityPointer& entity) {
     // If the content type has changed, or the old content type was QML, we need to
     // destroy the existing surface (because surfaces don't support changing the root
@@ -270,6 +291,11 @@ void WebEntityRenderer::doRender(RenderArgs* args) {
     PerformanceTimer perfTimer("WebEntityRenderer::render");
     withWriteLock([&] {
         _lastRenderTime = usecTimestampNow();
+        if (_idleThrottled && _webSurface) {
+            // back in view - restore the surface's configured rate
+            _webSurface->setMaxFps(currentMaxFPS());
+            _idleThrottled = false;
+        }
     });
 
     // Try to update the texture
@@ -98,15 +98,18 @@ private:
     QString _sourceURL;
     uint16_t _dpi;
     QString _scriptURL;
-    uint8_t _maxFPS;
+    uint8_t _maxFPS { WebEntityItem::DEFAULT_MAX_FPS };
     bool _useBackground;
     QString _userAgent;
     WebInputMode _inputMode;
 
     glm::vec3 _contextPosition;
 
+    uint8_t currentMaxFPS() const;
+
     QTimer _timer;
     uint64_t _lastRenderTime { 0 };
+    bool _idleThrottled { false };
 
     std::vector<QMetaObject::Connection> _connections;
 
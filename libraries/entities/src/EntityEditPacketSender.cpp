@@ -14,6 +14,7 @@
 #include <assert.h>
 
 #include <QJsonDocument>
+#include <QTimer>
 
 #include <AddressManager.h>
 #include <PerfStat.h>
@@ -71,6 +72,60 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
                                                     EntityTreePointer entityTree,
                                                     EntityItemID entityItemID,
                                                     const EntityItemProperties& properties) {
+    // domain-bound EntityEdit messages are coalesced within the frame: scripts that
+    // set properties one call at a time produce a single merged wire edit, flushed
+    // when queued messages are released or on the next event loop turn
+    if (type == PacketType::EntityEdit &&
+        properties.getEntityHostType() == entity::HostType::DOMAIN &&
+        !(entityTree && entityTree->isServerlessMode())) {
+
+        bool scheduleFlush = false;
+        {
+            std::lock_guard<std::mutex> lock(_pendingEditsLock);
+            auto it = _pendingEdits.find(entityItemID);
+            if (it != _pendingEdits.end()) {
+                it.value().properties.merge(properties);
+                return;
+            }
+            scheduleFlush = _pendingEdits.isEmpty();
+            _pendingEdits.insert(entityItemID, { entityTree, properties });
+            _pendingEditOrder.append(entityItemID);
+        }
+
+        if (scheduleFlush) {
+            // guarantee delivery even for callers that never release queued messages
+            QTimer::singleShot(0, this, [this] { flushPendingEditMessages(); });
+        }
+        return;
+    }
+
+    encodeAndQueueEditEntityMessage(type, entityTree, entityItemID, properties);
+}
+
+void EntityEditPacketSender::flushPendingEditMessages() {
+    QHash<EntityItemID, PendingEntityEdit> edits;
+    QVector<EntityItemID> order;
+    {
+        std::lock_guard<std::mutex> lock(_pendingEditsLock);
+        edits.swap(_pendingEdits);
+        order.swap(_pendingEditOrder);
+    }
+
+    for (const auto& entityItemID : order) {
+        const auto& edit = edits[entityItemID];
+        encodeAndQueueEditEntityMessage(PacketType::EntityEdit, edit.entityTree, entityItemID, edit.properties);
+    }
+}
+
+void EntityEditPacketSender::releaseQueuedMessages() {
+    flushPendingEditMessages();
+    OctreeEditPacketSender::releaseQueuedMessages();
+}
+
+void EntityEditPacketSender::encodeAndQueueEditEntityMessage(PacketType type,
+                                                             EntityTreePointer entityTree,
+                                                             EntityItemID entityItemID,
+                                                             const EntityItemProperties& properties) {
     if (properties.getEntityHostType() == entity::HostType::AVATAR) {
         if (!_myAvatar) {
             qCWarning(entities) << "Suppressing entity edit message: cannot send avatar entity edit with no myAvatar";
@@ -152,6 +207,9 @@ void EntityEditPacketSender::queueEditEntityMessage(PacketType type,
 }
 
 void EntityEditPacketSender::queueEraseEntityMessage(const EntityItemID& entityItemID) {
+    // erases bypass the edit coalescing map, so flush pending edits first to keep
+    // the wire in submission order (an edit queued this frame must precede the erase)
+    flushPendingEditMessages();
 
     QByteArray bufferOut(NLPacket::maxPayloadSize(PacketType::EntityErase), 0);
 
@@ -161,6 +219,10 @@ void EntityEditPacketSender::queueEraseEntityMessage(const EntityItemID& entityI
 }
 
 void EntityEditPacketSender::queueCloneEntityMessage(const EntityItemID& entityIDToClone, const EntityItemID& newEntityID) {
+    // clones bypass the edit coalescing map, so flush pending edits first - the
+    // clone must observe any same-frame edit to the source entity
+    flushPendingEditMessages();
+
     QByteArray bufferOut(NLPacket::maxPayloadSize(PacketType::EntityClone), 0);
 
     if (EntityItemProperties::encodeCloneEntityMessage(entityIDToClone, newEntityID, bufferOut)) {
@@ -41,6 +41,11 @@ public:
     void queueEraseEntityMessage(const EntityItemID& entityItemID);
     void queueCloneEntityMessage(const EntityItemID& entityIDToClone, const EntityItemID& newEntityID);
 
+    /// flushes edits coalesced within the current frame; also runs via releaseQueuedMessages
+    void flushPendingEditMessages();
+
+    virtual void releaseQueuedMessages() override;
+
     // My server type is the model server
     virtual char getMyNodeType() const override { return NodeType::EntityServer; }
     virtual void adjustEditPacketForClockSkew(PacketType type, QByteArray& buffer, qint64 clockSkew) override;
@@ -55,8 +60,21 @@ private:
     friend class MyAvatar;
     void queueEditAvatarEntityMessage(EntityTreePointer entityTree, EntityItemID entityItemID);
 
+    void encodeAndQueueEditEntityMessage(PacketType type, EntityTreePointer entityTree,
+                                         EntityItemID entityItemID, const EntityItemProperties& properties);
+
 private:
     std::mutex _mutex;
     AvatarData* _myAvatar { nullptr };
+
+    // intra-frame edit coalescing: multiple edits to one entity merge last-writer-wins
+    // per property and go out as a single wire edit at flush
+    struct PendingEntityEdit {
+        EntityTreePointer entityTree;
+        EntityItemProperties properties;
+    };
+    std::mutex _pendingEditsLock;
+    QHash<EntityItemID, PendingEntityEdit> _pendingEdits;
+    QVector<EntityItemID> _pendingEditOrder;
 };
 #endif // hifi_EntityEditPacketSender_h
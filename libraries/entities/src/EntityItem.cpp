@@ -1161,6 +1161,17 @@ void EntityItem::simulate(const quint64& now) {
     setLastSimulated(now);
 }
 
+// TODO: batching kinematic integration into SoA arrays (8-wide positions and
+// velocities, scattered back per frame) was evaluated for heavy conveyor and
+// projectile scenes. The integrator doesn't lane-vectorize as written: each
+// entity can take a different path (damping powf, acceleration rotated through
+// a parent transform, Bullet-substep quaternion loops for spinners), per-entity
+// timeElapsed differs with ownership and update timing, and the transform and
+// velocities round-trip through SpatiallyNestable's per-entity lock on both
+// ends. A batched pass needs the common straight-line case (no damping, no
+// acceleration, no spin) split out first - that subset is a pure
+// position += v * dt and covers most projectiles - with the general case left
+// on this path.
 bool EntityItem::stepKinematicMotion(float timeElapsed) {
     DETAILED_PROFILE_RANGE(simulation_physics, "StepKinematicMotion");
     // get all the data
@@ -140,12 +140,14 @@ void EntityScriptingInterface::setEntityTree(EntityTreePointer elementTree) {
     }
 }
 
-EntityItemProperties convertPropertiesToScriptSemantics(const EntityItemProperties& entitySideProperties,
-                                                        bool scalesWithParent) {
+void convertPropertiesToScriptSemantics(EntityItemProperties& entitySideProperties,
+                                        bool scalesWithParent) {
     // In EntityTree code, properties.position and properties.rotation are relative to the parent.  In javascript,
     // they are in world-space.  The local versions are put into localPosition and localRotation and position and
     // rotation are converted from local to world space.
-    EntityItemProperties scriptSideProperties = entitySideProperties;
+    // Converts in place: the conversion reads every source value before
+    // overwriting it, and EntityItemProperties is too expensive to copy around.
+    EntityItemProperties& scriptSideProperties = entitySideProperties;
     scriptSideProperties.setLocalPosition(entitySideProperties.getPosition());
     scriptSideProperties.setLocalRotation(entitySideProperties.getRotation());
     scriptSideProperties.setLocalVelocity(entitySideProperties.getVelocity());
@@ -185,17 +187,16 @@ EntityItemProperties convertPropertiesToScriptSemantics(const EntityItemProperti
     scriptSideProperties.setVelocity(worldVelocity);
     scriptSideProperties.setAngularVelocity(worldAngularVelocity);
     scriptSideProperties.setDimensions(worldDimensions);
-
-    return scriptSideProperties;
 }
 
 
-// TODO: this method looks expensive and should take properties by reference, update it, and return void
-EntityItemProperties convertPropertiesFromScriptSemantics(const EntityItemProperties& scriptSideProperties,
-                                                          bool scalesWithParent) {
+void convertPropertiesFromScriptSemantics(EntityItemProperties& scriptSideProperties,
+                                          bool scalesWithParent) {
     // convert position and rotation properties from world-space to local, unless localPosition and localRotation
     // are set.  If they are set, they overwrite position and rotation.
-    EntityItemProperties entitySideProperties = scriptSideProperties;
+    // Converts in place: each property family reads its own source values before
+    // overwriting them, and EntityItemProperties is too expensive to copy around.
+    EntityItemProperties& entitySideProperties = scriptSideProperties;
     bool success;
 
     if (scriptSideProperties.localPositionChanged()) {
@@ -248,8 +249,6 @@ EntityItemProperties convertPropertiesFromScriptSemantics(const EntityItemProper
                                                                               scalesWithParent, success);
         entitySideProperties.setDimensions(localDimensions);
     }
-
-    return entitySideProperties;
 }
 
 
@@ -513,7 +512,7 @@ QUuid EntityScriptingInterface::addEntityInternal(const EntityItemProperties& pr
 
     bool scalesWithParent = propertiesWithSimID.getScalesWithParent();
 
-    propertiesWithSimID = convertPropertiesFromScriptSemantics(propertiesWithSimID, scalesWithParent);
+    convertPropertiesFromScriptSemantics(propertiesWithSimID, scalesWithParent);
     propertiesWithSimID.setDimensionsInitialized(properties.dimensionsChanged());
     synchronizeEditedGrabProperties(propertiesWithSimID, QString());
 
@@ -656,7 +655,8 @@ EntityItemProperties EntityScriptingInterface::getEntityProperties(const QUuid&
         });
     }
 
-    return convertPropertiesToScriptSemantics(results, scalesWithParent);
+    convertPropertiesToScriptSemantics(results, scalesWithParent);
+    return results;
 }
 
 
@@ -779,8 +779,10 @@ QScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(QScri
     if (needsScriptSemantics) {
         PROFILE_RANGE(script_entities, "EntityScriptingInterface::getMultipleEntityProperties>Script Semantics");
         foreach(const auto& result, resultProperties) {
-            finalResult.setProperty(i++, convertPropertiesToScriptSemantics(result.properties, result.scalesWithParent)
-                .copyToScriptValue(engine, false, false, false, psuedoPropertyFlags));
+            EntityItemProperties scriptSemanticProperties = result.properties;
+            convertPropertiesToScriptSemantics(scriptSemanticProperties, result.scalesWithParent);
+            finalResult.setProperty(i++,
+                scriptSemanticProperties.copyToScriptValue(engine, false, false, false, psuedoPropertyFlags));
         }
     } else {
         PROFILE_RANGE(script_entities, "EntityScriptingInterface::getMultipleEntityProperties>Skip Script Semantics");
@@ -881,7 +883,8 @@ QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProp
     // TODO: it is possible there is no remaining useful changes in properties and we should bail early.
     // How to check for this cheaply?
 
-    properties = convertPropertiesFromScriptSemantics(properties, properties.getScalesWithParent());
+    bool scalesWithParent = properties.getScalesWithParent();
+    convertPropertiesFromScriptSemantics(properties, scalesWithParent);
     synchronizeEditedGrabProperties(properties, previousUserdata);
     properties.setLastEditedBy(sessionID);
 
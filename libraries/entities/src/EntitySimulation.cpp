@@ -11,7 +11,12 @@
 
 #include "EntitySimulation.h"
 
+#include <cfloat>
+
+#include <glm/gtx/norm.hpp>
+
 #include <AACube.h>
+#include <NumericalConstants.h>
 #include <Profile.h>
 
 #include "EntitiesLogging.h"
@@ -225,12 +230,61 @@ void EntitySimulation::clearEntities() {
     _nextExpiry = std::numeric_limits<uint64_t>::max();
 }
 
+void EntitySimulation::setSimulationViewerPositions(const std::vector<glm::vec3>& positions) {
+    QMutexLocker lock(&_mutex);
+    _viewerPositions = positions;
+    _viewerGatingEnabled = true;
+}
+
+bool EntitySimulation::shouldSuspendSimulation(const EntityItemPointer& entity, uint64_t now) const {
+    if (!_viewerGatingEnabled) {
+        return false;
+    }
+
+    // step suspended entities occasionally so their stored state stays roughly current
+    const uint64_t MAX_SUSPEND_TIME = 5 * USECS_PER_SECOND;
+    if (now - entity->getLastSimulated() > MAX_SUSPEND_TIME) {
+        return false;
+    }
+
+    // hysteresis band: entities resume inside the inner radius and suspend beyond the
+    // outer one; in between they keep their current state, so an entity sitting right
+    // at the boundary doesn't flap between stepping and catch-up jumps every tick
+    const float SIMULATION_RESUME_RADIUS = 100.0f;  // meters
+    const float SIMULATION_SUSPEND_RADIUS = 120.0f; // meters
+    const float RESUME_RADIUS_SQUARED = SIMULATION_RESUME_RADIUS * SIMULATION_RESUME_RADIUS;
+    const float SUSPEND_RADIUS_SQUARED = SIMULATION_SUSPEND_RADIUS * SIMULATION_SUSPEND_RADIUS;
+
+    glm::vec3 position = entity->getWorldPosition();
+    float nearestDistance2 = FLT_MAX;
+    for (const auto& viewer : _viewerPositions) {
+        nearestDistance2 = glm::min(nearestDistance2, glm::distance2(viewer, position));
+        if (nearestDistance2 < RESUME_RADIUS_SQUARED) {
+            return false;
+        }
+    }
+
+    if (nearestDistance2 > SUSPEND_RADIUS_SQUARED) {
+        return true;
+    }
+
+    // inside the band: an entity that has missed recent steps is currently suspended
+    const uint64_t RECENTLY_STEPPED_TIME = USECS_PER_SECOND / 10;
+    return (now - entity->getLastSimulated()) > RECENTLY_STEPPED_TIME;
+}
+
 void EntitySimulation::moveSimpleKinematics(uint64_t now) {
     PROFILE_RANGE_EX(simulation_physics, "MoveSimples", 0xffff00ff, (uint64_t)_simpleKinematicEntities.size());
     SetOfEntities::iterator itemItr = _simpleKinematicEntities.begin();
     while (itemItr != _simpleKinematicEntities.end()) {
         EntityItemPointer entity = *itemItr;
 
+        // nobody is near this entity; leave it suspended, to catch up when stepped next
+        if (shouldSuspendSimulation(entity, now)) {
+            ++itemItr;
+            continue;
+        }
+
         // The entity-server doesn't know where avatars are, so don't attempt to do simple extrapolation for
         // children of avatars.  See related code in EntityMotionState::remoteSimulationOutOfSync.
         bool ancestryIsKnown;
@@ -73,6 +73,12 @@ public:
 
     void moveSimpleKinematics(uint64_t now);
 
+    // Headless simulations can supply the positions of connected viewers: kinematic
+    // entities out of range of every viewer are then suspended (with a periodic
+    // catch-up step, and exact catch-up on resume since simulate() integrates from
+    // each entity's own last-simulated time). Gating stays off until first called.
+    void setSimulationViewerPositions(const std::vector<glm::vec3>& positions);
+
     EntityTreePointer getEntityTree() { return _entityTree; }
 
     virtual void prepareEntityForDelete(EntityItemPointer entity);
@@ -90,8 +96,14 @@ protected:
     void callUpdateOnEntitiesThatNeedIt(uint64_t now);
     virtual void sortEntitiesThatMoved();
 
+    // true when the entity is out of range of every supplied viewer and recently stepped
+    bool shouldSuspendSimulation(const EntityItemPointer& entity, uint64_t now) const;
+
     QRecursiveMutex _mutex;
 
+    std::vector<glm::vec3> _viewerPositions;    // guarded by _mutex
+    bool _viewerGatingEnabled { false };        // guarded by _mutex
+
     SetOfEntities _entitiesToSort; // entities moved by simulation (and might need resort in EntityTree)
     SetOfEntities _simpleKinematicEntities; // entities undergoing non-colliding kinematic motion
     SetOfEntities _deadEntitiesToRemoveFromTree;
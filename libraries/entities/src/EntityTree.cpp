@@ -27,6 +27,7 @@
 #include <QtScript/QScriptEngine>
 
 #include <Extents.h>
+#include <OctreeElementPool.h>
 #include <PerfStat.h>
 #include <Profile.h>
 #include <AddressManager.h>
@@ -78,7 +79,8 @@ void EntityTree::createRootElement() {
 }
 
 OctreeElementPointer EntityTree::createNewElement(unsigned char* octalCode) {
-    auto newElement = EntityTreeElementPointer(new EntityTreeElement(octalCode));
+    // pool-backed so elements created together are contiguous for traversal
+    auto newElement = std::allocate_shared<EntityTreeElement>(OctreeElementAllocator<EntityTreeElement>(), octalCode);
     newElement->setTree(std::static_pointer_cast<EntityTree>(shared_from_this()));
     return std::static_pointer_cast<OctreeElement>(newElement);
 }
@@ -114,6 +116,7 @@ void EntityTree::eraseDomainAndNonOwnedEntities() {
             }
         }
         _entityMap.swap(savedEntities);
+        ++_entityMapVersion;
     });
 
     resetClientEditStats();
@@ -142,6 +145,7 @@ void EntityTree::eraseAllOctreeElements(bool createNewRoot) {
     }
     QHash<EntityItemID, EntityItemPointer> localMap;
     localMap.swap(_entityMap);
+    ++_entityMapVersion;
     this->withWriteLock([&] {
         foreach(EntityItemPointer entity, localMap) {
             EntityTreeElementPointer element = entity->getElement();
@@ -1042,6 +1046,16 @@ bool evalInSphereOperation(const OctreeElementPointer& element, void* extraData)
     return false;
 }
 
+// TODO: proximity-trigger scripts re-run this descent with the same shape and
+// filter every frame. A persistent query session (register shape+filter once,
+// keep its result set updated from the add/move/delete paths, let the script
+// poll a changed list) would turn the steady-state cost into per-mutation
+// bookkeeping. The wiring exists for it - postAddEntity,
+// EntityTreeElement::bumpChangedContent, and deleteDescendantsOfEntity are the
+// three mutation funnels - but sessions have to be owned by
+// EntityScriptingInterface so they die with their script, and the result set
+// must be re-evaluated when an entity's dimensions or parent chain (not just
+// position) change, which is what makes this more than an afternoon's work.
 // NOTE: assumes caller has handled locking
 void EntityTree::evalEntitiesInSphere(const glm::vec3& center, float radius, PickFilter searchFilter, QVector<QUuid>& foundEntities) {
     FindEntitiesInSphereArgs args = { center, radius, searchFilter, QVector<QUuid>() };
@@ -1212,7 +1226,12 @@ EntityItemPointer EntityTree::findEntityByID(const QUuid& id) const {
 
 EntityItemPointer EntityTree::findEntityByEntityItemID(const EntityItemID& entityID) const {
     EntityItemPointer foundEntity = nullptr;
-    {
+
+    // fast path: when the lock-free snapshot is current, answer from it
+    auto snapshot = std::atomic_load(&_entityMapSnapshot);
+    if (snapshot && snapshot->version == _entityMapVersion.load(std::memory_order_acquire)) {
+        foundEntity = snapshot->map.value(entityID);
+    } else {
         QReadLocker locker(&_entityMapLock);
         foundEntity = _entityMap.value(entityID);
     }
@@ -2336,6 +2355,34 @@ void EntityTree::update(bool simulate) {
             _simulation->updateEntities();
         });
     }
+
+    refreshEntityMapSnapshot();
+}
+
+void EntityTree::refreshEntityMapSnapshot() {
+    auto snapshot = std::atomic_load(&_entityMapSnapshot);
+    uint64_t version = _entityMapVersion.load(std::memory_order_acquire);
+    if (snapshot && snapshot->version == version) {
+        return; // still current
+    }
+
+    // rate-limit refreshes: a stale snapshot only means lookups use the locked
+    // path, whereas every refresh makes the writer's next mutation detach the
+    // shared hash, so we don't want to chase a map in heavy churn
+    const quint64 SNAPSHOT_REFRESH_MIN_PERIOD = USECS_PER_SECOND;
+    quint64 now = usecTimestampNow();
+    if (now - _lastEntityMapSnapshotTime < SNAPSHOT_REFRESH_MIN_PERIOD) {
+        return;
+    }
+    _lastEntityMapSnapshotTime = now;
+
+    auto newSnapshot = std::make_shared<EntityMapSnapshot>();
+    {
+        QReadLocker locker(&_entityMapLock);
+        newSnapshot->map = _entityMap; // implicitly shared
+        newSnapshot->version = _entityMapVersion.load(std::memory_order_acquire);
+    }
+    std::atomic_store(&_entityMapSnapshot, std::shared_ptr<const EntityMapSnapshot>(std::move(newSnapshot)));
 }
 
 quint64 EntityTree::getAdjustedConsiderSince(quint64 sinceTime) {
@@ -2560,11 +2607,13 @@ void EntityTree::addEntityMapEntry(EntityItemPointer entity) {
         return;
     }
     _entityMap.insert(id, entity);
+    ++_entityMapVersion;
 }
 
 void EntityTree::clearEntityMapEntry(const EntityItemID& id) {
     QWriteLocker locker(&_entityMapLock);
     _entityMap.remove(id);
+    ++_entityMapVersion;
 }
 
 void EntityTree::debugDumpMap() {
@@ -12,6 +12,9 @@
 #ifndef hifi_EntityTree_h
 #define hifi_EntityTree_h
 
+#include <atomic>
+#include <memory>
+
 #include <QSet>
 #include <QVector>
 
@@ -330,6 +333,19 @@ protected:
     mutable QReadWriteLock _entityMapLock;
     QHash<EntityItemID, EntityItemPointer> _entityMap;
 
+    // Versioned read-only snapshot of _entityMap for lock-free lookups. Writers bump
+    // the version under the write lock; the snapshot is refreshed (rate-limited) from
+    // update(), so steady-state lookups never touch _entityMapLock while churn-heavy
+    // periods fall back to locked reads instead of copying the map per edit.
+    struct EntityMapSnapshot {
+        uint64_t version { 0 };
+        QHash<EntityItemID, EntityItemPointer> map;
+    };
+    void refreshEntityMapSnapshot();
+    std::shared_ptr<const EntityMapSnapshot> _entityMapSnapshot;
+    std::atomic<uint64_t> _entityMapVersion { 1 };
+    quint64 _lastEntityMapSnapshotTime { 0 };
+
     mutable QReadWriteLock _entityCertificateIDMapLock;
     QHash<QString, QList<EntityItemID>> _entityCertificateIDMap;
 
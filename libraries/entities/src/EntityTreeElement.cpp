@@ -14,6 +14,7 @@
 #include <glm/gtx/transform.hpp>
 
 #include <GeometryUtil.h>
+#include <OctreeElementPool.h>
 #include <OctreeUtils.h>
 #include <Extents.h>
 
@@ -32,7 +33,8 @@ EntityTreeElement::~EntityTreeElement() {
 }
 
 OctreeElementPointer EntityTreeElement::createNewElement(unsigned char* octalCode) {
-    auto newChild = EntityTreeElementPointer(new EntityTreeElement(octalCode));
+    // pool-backed so elements created together are contiguous for traversal
+    auto newChild = std::allocate_shared<EntityTreeElement>(OctreeElementAllocator<EntityTreeElement>(), octalCode);
     newChild->setTree(_myTree);
     return newChild;
 }
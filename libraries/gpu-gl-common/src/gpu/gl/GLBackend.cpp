@@ -540,6 +540,14 @@ public:
     PROFILE_RANGE(category, name); \
     GlDuration glProfileRangeThis(name);
 
+// TODO: a worker-thread translation stage (resolve state transitions, texture
+// binding slots, and uniform offsets into a raw call tape while the previous frame
+// draws, double-buffered) would cut the on-the-fly translation cost here. The
+// blocker is that translation is entangled with live GL object state: GLObject
+// backing stores are created lazily on first sync and transfer-pass side effects
+// feed the draw pass, so the tape cannot be resolved without a share-group context
+// on the worker. Until the object sync is split from command translation, this
+// backend replays batches on the GL thread.
 void GLBackend::render(const Batch& batch) {
     GL_PROFILE_RANGE(render_gpu_gl, batch.getName().c_str());
 
@@ -303,6 +303,7 @@ void GLBackend::setResourceTexture(unsigned int slot, const TexturePointer& reso
     // Always make sure the GLObject is in sync
     GLTexture* object = syncGPUObject(resourceTexture);
     if (object) {
+        object->_lastBindFrameCount = GLTexture::_globalBindFrameCount.load(std::memory_order_relaxed);
         assign(textureState._texture, resourceTexture);
         GLuint to = object->_texture;
         textureState._target = object->_target;
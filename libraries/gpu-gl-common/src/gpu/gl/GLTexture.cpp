@@ -16,6 +16,8 @@
 using namespace gpu;
 using namespace gpu::gl;
 
+std::atomic<uint64_t> GLTexture::_globalBindFrameCount { 1 };
+
 
 const GLenum GLTexture::CUBE_FACE_LAYOUT[GLTexture::TEXTURE_CUBE_NUM_FACES] = {
     GL_TEXTURE_CUBE_MAP_POSITIVE_X, GL_TEXTURE_CUBE_MAP_NEGATIVE_X,
@@ -14,6 +14,7 @@
 #include "GLShared.h"
 #include "GLBackend.h"
 #include "GLTexelFormat.h"
+#include <atomic>
 #include <thread>
 
 namespace gpu { namespace gl {
@@ -146,6 +147,11 @@ public:
     static const uint16_t INVALID_MIP { (uint16_t)-1 };
     static const uint8_t INVALID_FACE { (uint8_t)-1 };
 
+    // global frame counter ticked by the transfer engine and stamped onto textures
+    // at bind time, so demotion can prefer textures nothing has sampled recently
+    static std::atomic<uint64_t> _globalBindFrameCount;
+    uint64_t _lastBindFrameCount { 0 };
+
     ~GLTexture();
 
     const GLuint& _texture { _id };
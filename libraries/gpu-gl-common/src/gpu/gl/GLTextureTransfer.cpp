@@ -168,6 +168,8 @@ void GLTextureTransferEngineDefault::shutdown() {
 
 void GLTextureTransferEngineDefault::manageMemory() {
     PROFILE_RANGE(render_gpu_gl, __FUNCTION__);
+    // advance the bind-recency clock used by the demotion policy
+    GLTexture::_globalBindFrameCount.fetch_add(1, std::memory_order_relaxed);
     // reset the count used to limit the number of textures created per frame
     resetFrameTextureCreated();
     // Determine the current memory management state.  It will be either idle (no work to do),
@@ -504,13 +506,21 @@ void GLTextureTransferEngineDefault::processPromotes() {
 }
 
 void GLTextureTransferEngineDefault::processDemotes(size_t reliefRequired, const std::vector<TexturePointer>& strongTextures) {
-    // Demote largest first
+    // Demote stale textures first (nothing has bound them for a couple frames), and
+    // within each recency class, largest first - so a distant texture gives up its
+    // mips before something still being sampled every frame does.
+    const uint64_t STALE_BIND_FRAMES = 2;
+    uint64_t currentBindFrame = GLTexture::_globalBindFrameCount.load(std::memory_order_relaxed);
+
     ImmediateWorkQueue demoteQueue;
     for (const auto& texture : strongTextures) {
         GLTexture* gltexture = Backend::getGPUObject<GLTexture>(*texture);
         GLVariableAllocationSupport* vargltexture = dynamic_cast<GLVariableAllocationSupport*>(gltexture);
         if (!gltexture->_gpuObject.getImportant() && vargltexture->canDemote()) {
-            demoteQueue.push({ texture, (float)gltexture->size() });
+            bool stale = (currentBindFrame - gltexture->_lastBindFrameCount) > STALE_BIND_FRAMES;
+            // staleness dominates; size breaks ties within each class
+            const float STALE_PRIORITY_BOOST = 1.0e12f;
+            demoteQueue.push({ texture, (float)gltexture->size() + (stale ? STALE_PRIORITY_BOOST : 0.0f) });
         }
     }
 
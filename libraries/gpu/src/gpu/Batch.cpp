@@ -474,7 +474,8 @@ void Batch::restoreContextStereo() {
 
 void Batch::runLambda(std::function<void()> f) {
     ADD_COMMAND(runLambda);
-    _params.emplace_back(_lambdas.cache(f));
+    // move the capture into the cache rather than copying the closure's heap state
+    _params.emplace_back(_lambdas.cache(std::move(f)));
 }
 
 void Batch::startNamedCall(const std::string& name) {
@@ -407,6 +407,7 @@ public:
         typedef T Data;
         Data _data;
         Cache<T>(const Data& data) : _data(data) {}
+        Cache<T>(Data&& data) : _data(std::move(data)) {}
         static size_t _max;
 
         class Vector {
@@ -429,6 +430,12 @@ public:
                 return offset;
             }
 
+            size_t cache(Data&& data) {
+                size_t offset = _items.size();
+                _items.emplace_back(std::move(data));
+                return offset;
+            }
+
             const Data& get(uint32 offset) const {
                 assert((offset < _items.size()));
                 return (_items.data() + offset)->_data;
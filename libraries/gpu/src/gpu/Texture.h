@@ -585,6 +585,10 @@ public:
 
     // Serialize a texture into a KTX file
     static ktx::KTXUniquePointer serialize(const Texture& texture, const glm::ivec2& originalSize);
+    // Serialize a texture directly into a memory-mapped file on disk, avoiding the
+    // in-memory staging copy; the returned KTX is backed by the mapping
+    static ktx::KTXUniquePointer serializeToKTXFile(const Texture& texture, const glm::ivec2& originalSize,
+                                                    const std::string& filename);
 
     static std::pair<TexturePointer, glm::ivec2> build(const ktx::KTXDescriptor& descriptor);
     static std::pair<TexturePointer, glm::ivec2> unserialize(const std::string& ktxFile);
@@ -387,15 +387,18 @@ void Texture::setKtxBacking(const cache::FilePointer& cacheEntry) {
 }
 
 
-ktx::KTXUniquePointer Texture::serialize(const Texture& texture, const glm::ivec2& originalSize) {
-    ktx::Header header;
+// Build the header, image list, and key-values for serializing a texture; shared
+// by the in-memory and mapped-file write paths. The images reference the
+// texture's stored mip data and stay valid only while the texture is alive.
+static bool evalKTXSerialization(const Texture& texture, const glm::ivec2& originalSize,
+                                 ktx::Header& header, ktx::Images& images, ktx::KeyValues& keyValues) {
 
     // From texture format to ktx format description
     auto texelFormat = texture.getTexelFormat();
     auto mipFormat = texture.getStoredMipFormat();
 
     if (!Texture::evalKTXFormat(mipFormat, texelFormat, header)) {
-        return nullptr;
+        return false;
     }
 
     // Set Dimensions
@@ -435,13 +438,12 @@ ktx::KTXUniquePointer Texture::serialize(const Texture& texture, const glm::ivec
             break;
         }
         default:
-            return nullptr;
+            return false;
     }
 
     // Number level of mips coming
     header.numberOfMipmapLevels = texture.getNumMips();
 
-    ktx::Images images;
     uint32_t imageOffset = 0;
     for (uint32_t level = 0; level < header.numberOfMipmapLevels; level++) {
         auto mip = texture.accessStoredMipFace(level);
@@ -469,7 +471,6 @@ ktx::KTXUniquePointer Texture::serialize(const Texture& texture, const glm::ivec
     Byte keyvalPayload[GPUKTXPayload::SIZE];
     gpuKeyval.serialize(keyvalPayload);
 
-    ktx::KeyValues keyValues;
     keyValues.emplace_back(GPUKTXPayload::KEY, (uint32)GPUKTXPayload::SIZE, (ktx::Byte*) &keyvalPayload);
 
     if (texture.getIrradiance()) {
@@ -490,6 +491,17 @@ ktx::KTXUniquePointer Texture::serialize(const Texture& texture, const glm::ivec
         keyValues.emplace_back(SOURCE_HASH_KEY, static_cast<uint32>(binaryHash.size()), (ktx::Byte*) binaryHash.data());
     }
 
+    return true;
+}
+
+ktx::KTXUniquePointer Texture::serialize(const Texture& texture, const glm::ivec2& originalSize) {
+    ktx::Header header;
+    ktx::Images images;
+    ktx::KeyValues keyValues;
+    if (!evalKTXSerialization(texture, originalSize, header, images, keyValues)) {
+        return nullptr;
+    }
+
     auto ktxBuffer = ktx::KTX::create(header, images, keyValues);
 #if 0
     auto expectedMipCount = texture.evalNumMips();
@@ -520,6 +532,20 @@ ktx::KTXUniquePointer Texture::serialize(const Texture& texture, const glm::ivec
     return ktxBuffer;
 }
 
+ktx::KTXUniquePointer Texture::serializeToKTXFile(const Texture& texture, const glm::ivec2& originalSize,
+                                                  const std::string& filename) {
+    ktx::Header header;
+    ktx::Images images;
+    ktx::KeyValues keyValues;
+    if (!evalKTXSerialization(texture, originalSize, header, images, keyValues)) {
+        return nullptr;
+    }
+
+    // write through a file mapping, so serialization doesn't stage a second full
+    // copy of the texture in heap memory
+    return ktx::KTX::createFile(QString::fromStdString(filename), header, images, keyValues);
+}
+
 std::pair<TexturePointer, glm::ivec2> Texture::build(const ktx::KTXDescriptor& descriptor) {
     Format mipFormat = Format::COLOR_BGRA_32;
     Format texelFormat = Format::COLOR_SRGBA_32;
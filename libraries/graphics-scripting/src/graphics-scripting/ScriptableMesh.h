@@ -65,6 +65,18 @@ namespace scriptable {
      * @borrows GraphicsMesh.getVertextAttributes as getVertextAttributes
      * @borrows GraphicsMesh.setVertextAttributes as setVertextAttributes
      */
+    // TODO: per-attribute access below round-trips through QVariantList (one
+    // QVariant per component per vertex), which is what makes scripted mesh
+    // generation fall over past a few thousand vertices. The script engine
+    // already ships an ArrayBuffer/typed-array implementation
+    // (script-engine/ArrayBufferClass et al.), so the right shape is: expose an
+    // ArrayBuffer view over a staging copy of the attribute's gpu::BufferView,
+    // let the script mutate it in place, and add an explicit commit() that
+    // validates and uploads once. The view must be a staging copy rather than
+    // the live buffer - scripts run concurrently with rendering, and
+    // gpu::Buffer updates have to flow through the sysmem/update path to reach
+    // the backend - so "zero-copy" realistically means one copy in and one
+    // upload out instead of per-component boxing.
     class ScriptableMesh : public ScriptableMeshBase, QScriptable {
         Q_OBJECT
     public:
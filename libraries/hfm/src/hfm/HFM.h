@@ -64,6 +64,14 @@ static const int DRACO_ATTRIBUTE_TEX_COORD_1 = DRACO_BEGIN_CUSTOM_HIFI_ATTRIBUTE
 static const int DRACO_ATTRIBUTE_ORIGINAL_INDEX = DRACO_BEGIN_CUSTOM_HIFI_ATTRIBUTES + 2;
 
 // High Fidelity Model namespace
+//
+// TODO: a versioned flat binary serialization of hfm::Model (vertex/joint/material/
+// shape buffers written after first parse, memory-mapped on later loads) would let
+// warm-cache world re-entry skip the FBX/GLTF serializers entirely. The types below
+// are Qt-container heavy (QVector/QString throughout), so the format needs its own
+// flat layouts plus an invalidation key covering source content hash, serializer
+// version, and baker version - substantial enough to warrant its own change with
+// round-trip coverage rather than landing piecemeal here.
 namespace hfm {
 
 /// A single blendshape.
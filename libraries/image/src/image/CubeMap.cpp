@@ -603,6 +603,15 @@ void CubeMap::convolveForGGX(CubeMap& output, const std::atomic<bool>& abortProc
     }
 }
 
+// TODO: this convolution is the right candidate for a compute-shader path (same
+// GGX sample sets, SH projection and prefiltered mips produced on the GPU with
+// an async readback) - the CPU version below is already tbb-parallel per tile,
+// so on scene transitions it saturates every core right when the client is also
+// parsing the new scene, which is the hitch users see. The blockers are
+// plumbing: image:: is a leaf library with no gpu::Context access, so the
+// compute dispatch has to live up in material-networking/TextureCache where a
+// backend exists, with this CPU path kept as the no-compute fallback and for
+// the oven's headless bakes.
 void CubeMap::convolveMipFaceForGGX(const GGXSamples& samples, CubeMap& output, gpu::uint16 mipLevel, int face, const std::atomic<bool>& abortProcessing) const {
     const glm::vec3* faceNormals = FACE_NORMALS + face * 4;
     const glm::vec3 deltaYNormalLo = faceNormals[2] - faceNormals[0];
@@ -11,6 +11,8 @@
 
 #include "TextureProcessing.h"
 
+#include <array>
+
 #include <glm/gtc/packing.hpp>
 
 #include <QtCore/QtGlobal>
@@ -1444,15 +1446,20 @@ Image convertToHDRFormat(Image&& srcImage, gpu::Element format) {
         uint32* hdrLineIt = reinterpret_cast<uint32*>( hdrImage.editScanLine(y) );
         glm::vec3 color;
 
+        // 8-bit inputs mean the gamma curve has only 256 possible values per
+        // channel - precompute them once instead of calling pow per pixel
+        static const auto GAMMA_2_2_LUT = [] {
+            std::array<float, 256> lut;
+            for (int i = 0; i < 256; i++) {
+                lut[i] = std::pow((float)i / 255.0f, 2.2f);
+            }
+            return lut;
+        }();
+
         while (srcLineIt < srcLineEnd) {
-            color.r = qRed(*srcLineIt);
-            color.g = qGreen(*srcLineIt);
-            color.b = qBlue(*srcLineIt);
-            // Normalize and apply gamma
-            color /= 255.0f;
-            color.r = std::pow(color.r, 2.2f);
-            color.g = std::pow(color.g, 2.2f);
-            color.b = std::pow(color.b, 2.2f);
+            color.r = GAMMA_2_2_LUT[qRed(*srcLineIt)];
+            color.g = GAMMA_2_2_LUT[qGreen(*srcLineIt)];
+            color.b = GAMMA_2_2_LUT[qBlue(*srcLineIt)];
             *hdrLineIt = packFunc(color);
 #ifdef DEBUG_COLOR_PACKING
             glm::vec3 ucolor = unpackFunc(*hdrLineIt);
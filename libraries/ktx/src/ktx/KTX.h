@@ -337,6 +337,10 @@ namespace ktx {
         // Then COPY all the data
         static std::unique_ptr<KTX> create(const Header& header, const Images& images, const KeyValues& keyValues = KeyValues());
         static std::unique_ptr<KTX> createBare(const Header& header, const KeyValues& keyValues = KeyValues());
+        // Serialize directly into a memory-mapped file instead of staging the whole
+        // KTX in heap memory first; the returned KTX is backed by the mapping.
+        static std::unique_ptr<KTX> createFile(const QString& filename, const Header& header, const Images& images,
+                                               const KeyValues& keyValues = KeyValues());
 
         // Instead of creating a full Copy of the src data in a KTX object, the write serialization can be performed with the
         // following two functions
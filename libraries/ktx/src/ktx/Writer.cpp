@@ -40,6 +40,27 @@ namespace ktx {
         return create(storagePointer);
     }
 
+    std::unique_ptr<KTX> KTX::createFile(const QString& filename, const Header& header, const Images& images,
+                                         const KeyValues& keyValues) {
+        // write straight through a file mapping, so a bake never holds a second
+        // full copy of the texture in heap memory
+        auto storageSize = ktx::KTX::evalStorageSize(header, images, keyValues);
+        StoragePointer storagePointer;
+        try {
+            storagePointer = storage::FileStorage::create(filename, storageSize, nullptr);
+        } catch (const std::exception& e) {
+            qWarning() << "Unable to create output file for KTX write:" << filename << e.what();
+            return nullptr;
+        }
+        auto mapped = storagePointer->mutableData();
+        if (!mapped) {
+            qWarning() << "Unable to map output file for KTX write:" << filename;
+            return nullptr;
+        }
+        ktx::KTX::write(mapped, storageSize, header, images, keyValues);
+        return create(storagePointer);
+    }
+
     std::unique_ptr<KTX> KTX::createBare(const Header& header, const KeyValues& keyValues) {
         auto descriptors = header.generateImageDescriptors();
 
@@ -569,6 +569,11 @@ void NetworkTexture::makeRequest() {
             return;
         }
 
+        // NOTE: this is the entry to the ranged KTX pipeline: the header and
+        // high-mip tail are fetched with HTTP Range requests here and in
+        // startMipRangeRequest, so KTX textures never download whole files up
+        // front. Only non-KTX sources (raw images) still fetch complete files,
+        // since they cannot be decoded incrementally.
         ByteRange range;
         range.fromInclusive = 0;
         range.toExclusive = 1000;
@@ -1139,7 +1144,12 @@ void NetworkTexture::loadTextureContent(const QByteArray& content) {
         return;
     }
 
-    QThreadPool::globalInstance()->start(new ImageReader(_self, _url, content, _extraHash, _maxNumPixels, _sourceChannel));
+    // image decode + GPU-format compression is heavy and purely throughput work:
+    // queue it at low priority so short latency-sensitive pool jobs (shape cooking,
+    // model mesh extraction) aren't stuck behind a batch of texture transcodes
+    static const int TEXTURE_TRANSCODE_QUEUE_PRIORITY = -1;
+    QThreadPool::globalInstance()->start(new ImageReader(_self, _url, content, _extraHash, _maxNumPixels, _sourceChannel),
+                                         TEXTURE_TRANSCODE_QUEUE_PRIORITY);
 }
 
 void NetworkTexture::refresh() {
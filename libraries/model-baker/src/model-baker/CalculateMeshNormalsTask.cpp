@@ -11,17 +11,26 @@
 
 #include "CalculateMeshNormalsTask.h"
 
+#include <numeric>
+
+#include <QtConcurrent/QtConcurrent>
+
 #include "ModelMath.h"
 
 void CalculateMeshNormalsTask::run(const baker::BakeContextPointer& context, const Input& input, Output& output) {
     const auto& meshes = input;
     auto& normalsPerMeshOut = output;
 
-    normalsPerMeshOut.reserve(meshes.size());
-    for (int i = 0; i < (int)meshes.size(); i++) {
+    // meshes are independent, so compute them in parallel across the global pool;
+    // each slot is written only by its own mesh's job
+    normalsPerMeshOut.resize(meshes.size());
+
+    std::vector<int> meshIndices(meshes.size());
+    std::iota(meshIndices.begin(), meshIndices.end(), 0);
+
+    QtConcurrent::blockingMap(meshIndices, [&](int i) {
         const auto& mesh = meshes[i];
-        normalsPerMeshOut.emplace_back();
-        auto& normalsOut = normalsPerMeshOut[normalsPerMeshOut.size()-1];
+        auto& normalsOut = normalsPerMeshOut[i];
         // Only calculate normals if this mesh doesn't already have them
         if (!mesh.normals.empty()) {
             normalsOut = std::vector<glm::vec3>(mesh.normals.begin(), mesh.normals.end());
@@ -36,5 +45,5 @@ void CalculateMeshNormalsTask::run(const baker::BakeContextPointer& context, con
                 }
             );
         }
-    }
+    });
 }
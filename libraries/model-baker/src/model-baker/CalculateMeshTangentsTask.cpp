@@ -11,6 +11,10 @@
 
 #include "CalculateMeshTangentsTask.h"
 
+#include <numeric>
+
+#include <QtConcurrent/QtConcurrent>
+
 #include "ModelMath.h"
 
 void CalculateMeshTangentsTask::run(const baker::BakeContextPointer& context, const Input& input, Output& output) {
@@ -18,13 +22,18 @@ void CalculateMeshTangentsTask::run(const baker::BakeContextPointer& context, co
     const std::vector<hfm::Mesh>& meshes = input.get1();
     auto& tangentsPerMeshOut = output;
 
-    tangentsPerMeshOut.reserve(meshes.size());
-    for (int i = 0; i < (int)meshes.size(); i++) {
+    // meshes are independent, so compute them in parallel across the global pool;
+    // each slot is written only by its own mesh's job
+    tangentsPerMeshOut.resize(meshes.size());
+
+    std::vector<int> meshIndices(meshes.size());
+    std::iota(meshIndices.begin(), meshIndices.end(), 0);
+
+    QtConcurrent::blockingMap(meshIndices, [&](int i) {
         const auto& mesh = meshes[i];
         const auto& tangentsIn = mesh.tangents;
         const auto& normals = baker::safeGet(normalsPerMesh, i);
-        tangentsPerMeshOut.emplace_back();
-        auto& tangentsOut = tangentsPerMeshOut[tangentsPerMeshOut.size()-1];
+        auto& tangentsOut = tangentsPerMeshOut[i];
 
         // Check if we already have tangents and therefore do not need to do any calculation
         // Otherwise confirm if we have the normals and texcoords needed
@@ -42,5 +51,5 @@ void CalculateMeshTangentsTask::run(const baker::BakeContextPointer& context, co
                 return &(tangentsOut[firstIndex]);
             });
         }
-    }
+    });
 }
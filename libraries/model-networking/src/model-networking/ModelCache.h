@@ -154,6 +154,15 @@ private:
 };
 
 /// Stores cached model geometries.
+// NOTE on GPU sharing: avatars (and entities) wearing the same model URL
+// already share mesh and index gpu::Buffers - Geometry copies share _meshes by
+// pointer and only clone NetworkMaterials for per-instance texture overrides,
+// so per-Model private GPU state is limited to cluster matrices and blendshape
+// staging, which is inherently per instance. The remaining duplication is
+// cross-URL: the same mesh content served from two URLs (marketplace mirrors,
+// re-uploads) is resident twice. Collapsing that needs content addressing of
+// the parsed HFM - a hash computed in the model-baker/serializer layer - and
+// a second-level map here from content hash to the shared mesh vector.
 class ModelCache : public ResourceCache, public Dependency {
     Q_OBJECT
     SINGLETON_DEPENDENCY
@@ -11,6 +11,10 @@
 
 #include "FBXSerializer.h"
 
+#include <numeric>
+
+#include <QtConcurrent/QtConcurrent>
+
 #include <QBuffer>
 
 #include <glm/gtc/quaternion.hpp>
@@ -510,10 +514,39 @@ HFMModel* FBXSerializer::extractHFMModel(const hifi::VariantHash& mapping, const
                 }
             }
         } else if (child.name == "Objects") {
+            {
+                // collect the geometry mesh nodes first, so their (often Draco
+                // compressed) payloads decode in parallel across the thread pool
+                // while keeping the original mesh order and indices
+                std::vector<const FBXNode*> meshObjects;
+                foreach (const FBXNode& object, child.children) {
+                    if (object.name == "Geometry" && object.properties.at(2) == "Mesh") {
+                        meshObjects.push_back(&object);
+                    }
+                }
+
+                if (!meshObjects.empty()) {
+                    std::vector<ExtractedMesh> extractedMeshes(meshObjects.size());
+                    std::vector<int> meshJobs(meshObjects.size());
+                    std::iota(meshJobs.begin(), meshJobs.end(), 0);
+
+                    unsigned int firstMeshIndex = meshIndex;
+                    QtConcurrent::blockingMap(meshJobs, [&](int job) {
+                        unsigned int jobMeshIndex = firstMeshIndex + (unsigned int)job;
+                        extractedMeshes[job] = extractMesh(*meshObjects[job], jobMeshIndex, deduplicateIndices);
+                    });
+                    meshIndex = firstMeshIndex + (unsigned int)meshObjects.size();
+
+                    for (size_t i = 0; i < meshObjects.size(); ++i) {
+                        meshes.insert(getID(meshObjects[i]->properties), std::move(extractedMeshes[i]));
+                    }
+                }
+            }
+
             foreach (const FBXNode& object, child.children) {
                 if (object.name == "Geometry") {
                     if (object.properties.at(2) == "Mesh") {
-                        meshes.insert(getID(object.properties), extractMesh(object, meshIndex, deduplicateIndices));
+                        // already extracted in the parallel pass above
                     } else { // object.properties.at(2) == "Shape"
                         ExtractedBlendshape extracted = { getID(object.properties), extractBlendshape(object) };
                         blendshapes.append(extracted);
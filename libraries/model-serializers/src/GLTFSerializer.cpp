@@ -11,6 +11,8 @@
 
 #include "GLTFSerializer.h"
 
+#include <algorithm>
+
 #include <QtCore/QBuffer>
 #include <QtCore/QIODevice>
 #include <QtCore/QEventLoop>
@@ -167,7 +169,14 @@ hifi::ByteArray GLTFSerializer::setGLBChunks(const hifi::ByteArray& data) {
         tempBinLen.setByteOrder(QDataStream::LittleEndian);
         tempBinLen >> binLength;
 
-        _glbBinary = data.mid(binStart + byte, binLength);
+        // non-owning view into the caller's data buffer: copying the BIN chunk here
+        // doubled peak memory for large .glb files. read() drops this (and the
+        // buffer blobs sharing it) before the caller's buffer goes away.
+        // clamp a malformed declared length the way mid() used to
+        binLength = std::min(binLength, data.size() - (binStart + byte));
+        if (binLength > 0) {
+            _glbBinary = QByteArray::fromRawData(data.constData() + binStart + byte, binLength);
+        }
     }
     return jsonChunk;
 }
@@ -1701,21 +1710,25 @@ HFMModel::Pointer GLTFSerializer::read(const hifi::ByteArray& data, const hifi::
         _url = hifi::URL(QFileInfo(localFileName).absoluteFilePath());
     }
 
+    HFMModel::Pointer hfmModelPtr;
     if (parseGLTF(data)) {
         //_file.dump();
-        auto hfmModelPtr = std::make_shared<HFMModel>();
+        hfmModelPtr = std::make_shared<HFMModel>();
         HFMModel& hfmModel = *hfmModelPtr;
         buildGeometry(hfmModel, mapping, _url);
 
         //hfmModel.debugDump();
         //glTFDebugDump();
-
-        return hfmModelPtr;
     } else {
         qCDebug(modelformat) << "Error parsing GLTF file.";
     }
 
-    return nullptr;
+    // _glbBinary is a non-owning view into the caller's data buffer, and buffer
+    // blobs may share it - drop them before that buffer goes away
+    _glbBinary.clear();
+    _file.buffers.clear();
+
+    return hfmModelPtr;
 }
 
 bool GLTFSerializer::readBinary(const QString& url, hifi::ByteArray& outdata) {
@@ -235,6 +235,18 @@ void DomainHandler::setURLAndID(QUrl domainURL, QUuid domainID) {
                     // re-set the sock addr to null and fire off a lookup of the IP address for this domain-server's hostname
                     qCDebug(networking, "Looking up DS hostname %s.", domainURL.host().toLocal8Bit().constData());
                     QHostInfo::lookupHost(domainURL.host(), this, SLOT(completedHostnameLookup(const QHostInfo&)));
+
+                    // if we've resolved this host before, start checking in against the
+                    // last known address right away - the lookup result corrects the
+                    // address if the domain moved
+                    QHostAddress cachedAddress(_lastKnownHostAddresses.get().value(domainURL.host()).toString());
+                    if (!cachedAddress.isNull()) {
+                        qCDebug(networking) << "Using cached address" << cachedAddress.toString()
+                            << "for" << domainURL.host() << "while lookup completes";
+                        _sockAddr.setAddress(cachedAddress);
+                        _socketDiscoveredFromCache = true;
+                        emit completedSocketDiscovery();
+                    }
                 }
 
                 DependencyManager::get<NodeList>()->flagTimeForConnectionStep(
@@ -333,14 +345,25 @@ QString DomainHandler::getViewPointFromNamedPath(QString namedPath) {
 void DomainHandler::completedHostnameLookup(const QHostInfo& hostInfo) {
     for (int i = 0; i < hostInfo.addresses().size(); i++) {
         if (hostInfo.addresses()[i].protocol() == QAbstractSocket::IPv4Protocol) {
+            bool addressChanged = _sockAddr.getAddress() != hostInfo.addresses()[i];
             _sockAddr.setAddress(hostInfo.addresses()[i]);
 
+            // remember the resolution for instant reconnects to this host
+            QVariantMap lastKnown = _lastKnownHostAddresses.get();
+            lastKnown[_domainURL.host()] = _sockAddr.getAddress().toString();
+            _lastKnownHostAddresses.set(lastKnown);
+
             DependencyManager::get<NodeList>()->flagTimeForConnectionStep(LimitedNodeList::ConnectionStep::SetDomainSocket);
 
             qCDebug(networking, "DS at %s is at %s", _domainURL.host().toLocal8Bit().constData(),
                    _sockAddr.getAddress().toString().toLocal8Bit().constData());
 
-            emit completedSocketDiscovery();
+            // if we already kicked off check-ins against the cached address and it
+            // still holds, a second discovery emission would just double up check-ins
+            if (!_socketDiscoveredFromCache || addressChanged) {
+                emit completedSocketDiscovery();
+            }
+            _socketDiscoveredFromCache = false;
 
             return;
         }
@@ -318,6 +318,11 @@ private:
     Setting::Handle<bool> _enableInterstitialMode { "enableInterstitialMode", false };
 #endif
 
+    // last successful hostname resolutions, used to start check-ins immediately
+    // on reconnect while the fresh DNS lookup is still in flight
+    Setting::Handle<QVariantMap> _lastKnownHostAddresses { "DomainHandler.lastKnownHostAddresses", QVariantMap() };
+    bool _socketDiscoveredFromCache { false };
+
     QSet<QString> _domainConnectionRefusals;
     bool _hasCheckedForAccessToken { false };
     bool _hasCheckedForDomainAccessToken { false };
@@ -16,7 +16,9 @@
 
 #include <QUuid>
 #include "NetworkLogging.h"
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
 HMACAuth::HMACAuth(AuthMethod authMethod)
@@ -42,35 +44,37 @@ HMACAuth::~HMACAuth() {
 }
 #endif
 
-bool HMACAuth::setKey(const char* keyValue, int keyLen) {
-    const EVP_MD* sslStruct = nullptr;
-
+const EVP_MD* HMACAuth::evpForAuthMethod() const {
     switch (_authMethod) {
     case MD5:
-        sslStruct = EVP_md5();
-        break;
+        return EVP_md5();
 
     case SHA1:
-        sslStruct = EVP_sha1();
-        break;
+        return EVP_sha1();
 
     case SHA224:
-        sslStruct = EVP_sha224();
-        break;
+        return EVP_sha224();
 
     case SHA256:
-        sslStruct = EVP_sha256();
-        break;
+        return EVP_sha256();
 
     case RIPEMD160:
-        sslStruct = EVP_ripemd160();
-        break;
+        return EVP_ripemd160();
 
     default:
+        return nullptr;
+    }
+}
+
+bool HMACAuth::setKey(const char* keyValue, int keyLen) {
+    const EVP_MD* sslStruct = evpForAuthMethod();
+    if (!sslStruct) {
         return false;
     }
 
     QMutexLocker lock(&_lock);
+    _keyValue.assign(reinterpret_cast<const unsigned char*>(keyValue),
+                     reinterpret_cast<const unsigned char*>(keyValue) + keyLen);
     return (bool) HMAC_Init_ex(_hmacContext, keyValue, keyLen, sslStruct, nullptr);
 }
 
@@ -105,13 +109,32 @@ HMACAuth::HMACHash HMACAuth::result() {
 }
 
 bool HMACAuth::calculateHash(HMACHash& hashResult, const char* data, int dataLen) {
-    QMutexLocker lock(&_lock);
-    if (!addData(data, dataLen)) {
-        qCWarning(networking) << "Error occured calling HMACAuth::addData()";
+    // snapshot the key under the lock, then run a one-shot HMAC with no shared
+    // state - callers on different threads hash in parallel instead of taking
+    // turns on the streaming context
+    unsigned char key[EVP_MAX_MD_SIZE];
+    size_t keyLen = 0;
+    {
+        QMutexLocker lock(&_lock);
+        keyLen = std::min(_keyValue.size(), sizeof(key));
+        memcpy(key, _keyValue.data(), keyLen);
+    }
+
+    const EVP_MD* sslStruct = evpForAuthMethod();
+    if (!sslStruct || keyLen == 0) {
+        qCWarning(networking) << "HMACAuth::calculateHash called without a key";
+        return false;
+    }
+
+    hashResult.resize(EVP_MAX_MD_SIZE);
+    unsigned int hashLen = 0;
+    if (!HMAC(sslStruct, key, (int)keyLen, reinterpret_cast<const unsigned char*>(data), dataLen,
+              hashResult.data(), &hashLen)) {
+        qCWarning(networking) << "Error occured calling HMAC";
         assert(false);
         return false;
     }
 
-    hashResult = result();
+    hashResult.resize((size_t)hashLen);
     return true;
 }
@@ -28,7 +28,9 @@ public:
 
     bool setKey(const char* keyValue, int keyLen);
     bool setKey(const QUuid& uidKey);
-    // Calculate complete hash in one.
+    // Calculate complete hash in one. Runs as a one-shot on the caller's stack with a
+    // snapshot of the key, so concurrent callers (send and receive threads hashing for
+    // the same node) don't serialize on the streaming context's lock.
     bool calculateHash(HMACHash& hashResult, const char* data, int dataLen);
 
     // Append to data to be hashed.
@@ -39,9 +41,12 @@ public:
     HMACHash result();
 
 private:
+    const struct evp_md_st* evpForAuthMethod() const;
+
     QRecursiveMutex _lock;
     struct hmac_ctx_st* _hmacContext;
     AuthMethod _authMethod;
+    HMACHash _keyValue; // guarded by _lock; snapshotted by calculateHash
 };
 
 #endif  // hifi_HMACAuth_h
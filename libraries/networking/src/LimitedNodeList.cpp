@@ -603,10 +603,33 @@ SharedNodePointer LimitedNodeList::nodeWithUUID(const QUuid& nodeUUID) {
  }
 
 SharedNodePointer LimitedNodeList::nodeWithLocalID(Node::LocalID localID) const {
+    // Packet demux resolves the same sender over and over, so keep a per-thread
+    // cache of the last match, validated against an epoch that mutators bump;
+    // most lookups then avoid the node mutex entirely.
+    struct CachedNodeMatch {
+        const LimitedNodeList* list { nullptr };
+        Node::LocalID localID { 0 };
+        uint64_t epoch { 0 };
+        SharedNodePointer node;
+    };
+    static thread_local CachedNodeMatch lastMatch;
+
+    uint64_t epoch = _nodeMapEpoch.load(std::memory_order_acquire);
+    if (lastMatch.node && lastMatch.list == this && lastMatch.localID == localID && lastMatch.epoch == epoch) {
+        return lastMatch.node;
+    }
+
     QReadLocker readLocker(&_nodeMutex);
 
     LocalIDMapping::const_iterator idIter = _localIDMap.find(localID);
-    return idIter == _localIDMap.cend() ? nullptr : idIter->second;
+    SharedNodePointer node = idIter == _localIDMap.cend() ? nullptr : idIter->second;
+
+    lastMatch.list = this;
+    lastMatch.localID = localID;
+    lastMatch.epoch = epoch;
+    lastMatch.node = node;
+
+    return node;
 }
 
 void LimitedNodeList::eraseAllNodes(QString reason) {
@@ -626,6 +649,7 @@ void LimitedNodeList::eraseAllNodes(QString reason) {
             }
         }
         _localIDMap.clear();
+        ++_nodeMapEpoch;
         _nodeHash.clear();
     }
 
@@ -652,6 +676,7 @@ bool LimitedNodeList::killNodeWithUUID(const QUuid& nodeUUID, ConnectionID newCo
             QWriteLocker writeLocker(&_nodeMutex);
             _localIDMap.unsafe_erase(matchingNode->getLocalID());
             _nodeHash.unsafe_erase(matchingNode->getUUID());
+            ++_nodeMapEpoch;
         }
 
         handleNodeKill(matchingNode, newConnectionID);
@@ -712,6 +737,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
                 QWriteLocker writeLocker(&_nodeMutex);
                 _localIDMap.unsafe_erase(node->getLocalID());
                 _nodeHash.unsafe_erase(node->getUUID());
+                ++_nodeMapEpoch;
             }
             handleNodeKill(node);
         }
@@ -756,6 +782,7 @@ SharedNodePointer LimitedNodeList::addOrUpdateNode(const QUuid& uuid, NodeType_t
         // insert the new node and release our read lock
         _nodeHash.insert({ newNode->getUUID(), newNodePointer });
         _localIDMap.insert({ localID, newNodePointer });
+        ++_nodeMapEpoch;
     }
 
     qCDebug(networking) << "Added" << *newNode;
@@ -901,6 +928,23 @@ unsigned int LimitedNodeList::broadcastToNodes(std::unique_ptr<NLPacket> packet,
     return n;
 }
 
+unsigned int LimitedNodeList::broadcastPacket(const NLPacket& packet, const std::vector<SharedNodePointer>& destinationNodes) {
+    // reliable packets can't share a body: each connection's SendQueue owns its
+    // buffer for retransmission, so reliable fanout still goes through
+    // broadcastToNodes' per-node copy
+    Q_ASSERT_X(!packet.isReliable(), "LimitedNodeList::broadcastPacket",
+               "Trying to broadcast a reliable packet through the shared-payload path.");
+
+    unsigned int n = 0;
+    for (const auto& node : destinationNodes) {
+        if (node && node->getActiveSocket()) {
+            sendUnreliablePacket(packet, *node);
+            ++n;
+        }
+    }
+    return n;
+}
+
 SharedNodePointer LimitedNodeList::soloNodeOfType(NodeType_t nodeType) {
     return nodeMatchingPredicate([&](const SharedNodePointer& node){
         return node->getType() == nodeType;
@@ -922,6 +966,7 @@ void LimitedNodeList::removeSilentNodes() {
             // call the NodeHash erase to get rid of this node
             _localIDMap.unsafe_erase(node->getLocalID());
             it = _nodeHash.unsafe_erase(it);
+            ++_nodeMapEpoch;
 
             killedNodes.insert(node);
         } else {
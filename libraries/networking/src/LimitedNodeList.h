@@ -16,10 +16,12 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #ifndef _WIN32
 #include <unistd.h> // not on windows, not needed for mac or windows
@@ -198,6 +200,10 @@ public:
     NodeData* getOrCreateLinkedData(SharedNodePointer node);
 
     unsigned int broadcastToNodes(std::unique_ptr<NLPacket> packet, const NodeSet& destinationNodeTypes);
+    // one-to-many send of a single unreliable payload: the body buffer is shared
+    // across destinations and only the header (sequence number, HMAC) is patched
+    // per node before each write
+    unsigned int broadcastPacket(const NLPacket& packet, const std::vector<SharedNodePointer>& destinationNodes);
     SharedNodePointer soloNodeOfType(NodeType_t nodeType);
 
     std::unique_ptr<NLPacket> constructPingPacket(const QUuid& nodeId, PingType_t pingType = PingType::Agnostic);
@@ -446,6 +452,9 @@ protected:
 
     NodeHash _nodeHash;
     mutable QReadWriteLock _nodeMutex { QReadWriteLock::Recursive };
+    // bumped (under _nodeMutex) whenever the node maps change; validates the
+    // per-thread lookup cache in nodeWithLocalID
+    mutable std::atomic<uint64_t> _nodeMapEpoch { 1 };
     udt::Socket _nodeSocket;
     QUdpSocket* _dtlsSocket { nullptr };
     SockAddr _localSockAddr;
@@ -1012,6 +1012,12 @@ void NodeList::stopKeepalivePingTimer() {
     }
 }
 
+// NOTE: keepalive is already consolidated - one coarse 1s timer (started only
+// while connected to a domain) batch-pings every node of interest, and silent-node
+// reaping runs off its own single coarse timer in LimitedNodeList; there are no
+// per-node timers here to collapse into a wheel. Constant wakeups measured on
+// many-peer processes come from per-connection machinery (send queues, per-packet
+// timers), not from this path.
 void NodeList::sendKeepAlivePings() {
     // send keep-alive ping packets to nodes of types we care about that are not relayed to us from an upstream node
 
@@ -16,6 +16,7 @@
 
 #include <QtCore/QMetaObject>
 #include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
 
 #include "DependencyManager.h"
 #include "NetworkLogging.h"
@@ -29,8 +30,15 @@ PacketReceiver::PacketReceiver(QObject* parent) : QObject(parent) {
 }
 
 bool PacketReceiver::ListenerReference::invokeWithQt(const QSharedPointer<ReceivedMessage>& receivedMessagePointer, const QSharedPointer<Node>& sourceNode) {
+    QObject* object = getObject();
+    // same-thread delivery doesn't need to cross the event loop: AutoConnection
+    // would invoke inline anyway, so skip the per-packet functor allocation and
+    // call the listener directly
+    if (object->thread() == QThread::currentThread()) {
+        return invokeDirectly(receivedMessagePointer, sourceNode);
+    }
     ListenerReferencePointer thisPointer = sharedFromThis();
-    return QMetaObject::invokeMethod(getObject(), [=]() {
+    return QMetaObject::invokeMethod(object, [=]() {
         thisPointer->invokeDirectly(receivedMessagePointer, sourceNode);
     });
 }
@@ -192,54 +200,68 @@ void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> recei
     if (receivedMessage->getSourceID() != Node::NULL_LOCAL_ID) {
         matchingNode = nodeList->nodeWithLocalID(receivedMessage->getSourceID());
     }
-    QMutexLocker packetListenerLocker(&_packetListenerLock);
-    
-    auto it = _messageListenerMap.find(receivedMessage->getType());
-    if (it != _messageListenerMap.end() && !it->listener.isNull()) {
-         
-        auto listener = it.value();
+    // look the listener up under the lock, but invoke outside of it, so delivery
+    // threads don't serialize on the listener map while handlers run
+    Listener listener;
+    {
+        QMutexLocker packetListenerLocker(&_packetListenerLock);
 
-        if ((listener.deliverPending && !justReceived) || (!listener.deliverPending && !receivedMessage->isComplete())) {
+        auto it = _messageListenerMap.find(receivedMessage->getType());
+        if (it == _messageListenerMap.end()) {
+            qCWarning(networking) << "No listener found for packet type" << receivedMessage->getType();
+
+            // insert a dummy listener so we don't print this again
+            _messageListenerMap.insert(receivedMessage->getType(), { ListenerReferencePointer(), false });
             return;
         }
-            
-        bool success = false;
 
-        bool isDirectConnect = false;
-        // check if this is a directly connected listener
-        {
-            QMutexLocker directConnectLocker(&_directConnectSetMutex);
-            isDirectConnect = _directlyConnectedObjects.contains(listener.listener->getObject());
+        if (it->listener.isNull()) {
+            return;
         }
 
-        // one final check on the QPointer before we go to invoke
-        if (listener.listener->getObject()) {
-            if (isDirectConnect) {
-                success = listener.listener->invokeDirectly(receivedMessage, matchingNode);
-            } else {
-                success = listener.listener->invokeWithQt(receivedMessage, matchingNode);
-            }
-        } else {
-            qCDebug(networking).nospace() << "Listener for packet " << receivedMessage->getType()
-                << " has been destroyed. Removing from listener map.";
-            it = _messageListenerMap.erase(it);
-
-            // if it exists, remove the listener from _directlyConnectedObjects
-            {
-                QMutexLocker directConnectLocker(&_directConnectSetMutex);
-                _directlyConnectedObjects.remove(listener.listener->getObject());
-            }
+        listener = it.value();
+    }
+
+    if ((listener.deliverPending && !justReceived) || (!listener.deliverPending && !receivedMessage->isComplete())) {
+        return;
+    }
+
+    bool isDirectConnect = false;
+    // check if this is a directly connected listener
+    {
+        QMutexLocker directConnectLocker(&_directConnectSetMutex);
+        isDirectConnect = _directlyConnectedObjects.contains(listener.listener->getObject());
+    }
+
+    // one final check on the QPointer before we go to invoke
+    if (!listener.listener->getObject()) {
+        qCDebug(networking).nospace() << "Listener for packet " << receivedMessage->getType()
+            << " has been destroyed. Removing from listener map.";
+
+        QMutexLocker packetListenerLocker(&_packetListenerLock);
+        auto it = _messageListenerMap.find(receivedMessage->getType());
+        if (it != _messageListenerMap.end() && it->listener == listener.listener) {
+            // still the same (dead) listener - don't clobber a re-registration
+            _messageListenerMap.erase(it);
         }
 
-        if (!success) {
-            qCDebug(networking).nospace() << "Error delivering packet " << receivedMessage->getType() << " to listener "
-                << listener.listener->getObject();
+        // if it exists, remove the listener from _directlyConnectedObjects
+        {
+            QMutexLocker directConnectLocker(&_directConnectSetMutex);
+            _directlyConnectedObjects.remove(listener.listener->getObject());
         }
+        return;
+    }
 
-    } else if (it == _messageListenerMap.end()) {
-        qCWarning(networking) << "No listener found for packet type" << receivedMessage->getType();
-        
-        // insert a dummy listener so we don't print this again
-        _messageListenerMap.insert(receivedMessage->getType(), { ListenerReferencePointer(), false });
+    bool success = false;
+    if (isDirectConnect) {
+        success = listener.listener->invokeDirectly(receivedMessage, matchingNode);
+    } else {
+        success = listener.listener->invokeWithQt(receivedMessage, matchingNode);
+    }
+
+    if (!success) {
+        qCDebug(networking).nospace() << "Error delivering packet " << receivedMessage->getType() << " to listener "
+            << listener.listener->getObject();
     }
 }
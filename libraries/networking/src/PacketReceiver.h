@@ -111,7 +111,7 @@ private:
 
     struct Listener {
         ListenerReferencePointer listener;
-        bool deliverPending;
+        bool deliverPending { false };
     };
 
     void handleVerifiedMessage(QSharedPointer<ReceivedMessage> message, bool justReceived);
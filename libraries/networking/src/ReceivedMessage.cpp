@@ -19,13 +19,11 @@
 int receivedMessageMetaTypeId = qRegisterMetaType<ReceivedMessage*>("ReceivedMessage*");
 int sharedPtrReceivedMessageMetaTypeId = qRegisterMetaType<QSharedPointer<ReceivedMessage>>("QSharedPointer<ReceivedMessage>");
 
-static const int HEAD_DATA_SIZE = 512;
-
 using namespace std::chrono;
 
 ReceivedMessage::ReceivedMessage(const NLPacketList& packetList)
     : _data(packetList.getMessage()),
-      _headData(_data.mid(0, HEAD_DATA_SIZE)),
+      _headData(_data),  // shares the buffer; appends detach _data, leaving the head intact
       _numPackets(packetList.getNumPackets()),
       _sourceID(packetList.getSourceID()),
       _packetType(packetList.getType()),
@@ -37,7 +35,7 @@ ReceivedMessage::ReceivedMessage(const NLPacketList& packetList)
 
 ReceivedMessage::ReceivedMessage(NLPacket& packet)
     : _data(packet.readAll()),
-      _headData(_data.mid(0, HEAD_DATA_SIZE)),
+      _headData(_data),  // shares the buffer; appends detach _data, leaving the head intact
       _numPackets(1),
       _sourceID(packet.getSourceID()),
       _packetType(packet.getType()),
@@ -51,7 +49,7 @@ ReceivedMessage::ReceivedMessage(NLPacket& packet)
 ReceivedMessage::ReceivedMessage(QByteArray byteArray, PacketType packetType, PacketVersion packetVersion,
                 const SockAddr& senderSockAddr, NLPacket::LocalID sourceID) :
     _data(byteArray),
-    _headData(_data.mid(0, HEAD_DATA_SIZE)),
+    _headData(_data),  // shares the buffer; appends detach _data, leaving the head intact
     _numPackets(1),
     _firstPacketReceiveTime(0),
     _sourceID(sourceID),
@@ -605,12 +605,14 @@ void Resource::ensureLoading() {
 }
 
 void Resource::setLoadPriority(const QPointer<QObject>& owner, float priority) {
+    _loadPriorityCacheDirty = true;
     if (!_failedToLoad) {
         _loadPriorities.insert(owner, priority);
     }
 }
 
 void Resource::setLoadPriorities(const QHash<QPointer<QObject>, float>& priorities) {
+    _loadPriorityCacheDirty = true;
     if (_failedToLoad) {
         return;
     }
@@ -621,25 +623,39 @@ void Resource::setLoadPriorities(const QHash<QPointer<QObject>, float>& prioriti
 }
 
 void Resource::clearLoadPriority(const QPointer<QObject>& owner) {
+    _loadPriorityCacheDirty = true;
     if (!_failedToLoad) {
         _loadPriorities.remove(owner);
     }
 }
 
 float Resource::getLoadPriority() {
-    if (_loadPriorities.size() == 0) {
-        return 0;
-    }
-
-    float highestPriority = -FLT_MAX;
-    for (QHash<QPointer<QObject>, float>::iterator it = _loadPriorities.begin(); it != _loadPriorities.end(); ) {
-        if (it.key().isNull()) {
-            it = _loadPriorities.erase(it);
-            continue;
+    // the pending-request scan calls this for every queued resource each time one is
+    // popped, so cache the computed priority until an owner changes it (a deleted
+    // owner leaves the cache stale until the next mutation, which only means the
+    // resource keeps its old place in line)
+    if (!_loadPriorityCacheDirty) {
+        return _cachedLoadPriority;
+    }
+
+    float highestPriority = 0.0f;
+    if (_loadPriorities.size() != 0) {
+        highestPriority = -FLT_MAX;
+        for (QHash<QPointer<QObject>, float>::iterator it = _loadPriorities.begin(); it != _loadPriorities.end(); ) {
+            if (it.key().isNull()) {
+                it = _loadPriorities.erase(it);
+                continue;
+            }
+            highestPriority = qMax(highestPriority, it.value());
+            it++;
+        }
+        if (_loadPriorities.size() == 0) {
+            highestPriority = 0.0f;
         }
-        highestPriority = qMax(highestPriority, it.value());
-        it++;
     }
+
+    _cachedLoadPriority = highestPriority;
+    _loadPriorityCacheDirty = false;
     return highestPriority;
 }
 
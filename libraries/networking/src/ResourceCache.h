@@ -538,6 +538,8 @@ protected:
     bool _loaded = false;
 
     QHash<QPointer<QObject>, float> _loadPriorities;
+    float _cachedLoadPriority { 0.0f };
+    bool _loadPriorityCacheDirty { true };
     QWeakPointer<Resource> _self;
     QPointer<ResourceCache> _cache;
 
@@ -13,12 +13,49 @@
 
 #include "BasePacket.h"
 
+#include <vector>
+
 #include "../NetworkLogging.h"
 
 using namespace udt;
 
 const qint64 BasePacket::PACKET_WRITE_ERROR = -1;
 
+// cap on how many full-MTU buffers each thread keeps around for reuse
+static const int PACKET_BUFFER_POOL_MAX = 64;
+static thread_local std::vector<std::unique_ptr<char[]>> packetBufferPool;
+
+std::unique_ptr<char[]> BasePacket::allocatePacketBuffer(qint64 size) {
+    if (size > MAX_PACKET_SIZE) {
+        // oversized (e.g. copied from an oversized source) - still safe to recycle later,
+        // since pooled buffers only ever need MAX_PACKET_SIZE of capacity
+        return std::unique_ptr<char[]>(new char[size]());
+    }
+
+    if (!packetBufferPool.empty()) {
+        auto buffer = std::move(packetBufferPool.back());
+        packetBufferPool.pop_back();
+
+        // match the zero-initialization of a fresh allocation
+        memset(buffer.get(), 0, size);
+        return buffer;
+    }
+
+    return std::unique_ptr<char[]>(new char[MAX_PACKET_SIZE]());
+}
+
+void BasePacket::recyclePacketBuffer(std::unique_ptr<char[]> buffer) {
+    if ((int)packetBufferPool.size() < PACKET_BUFFER_POOL_MAX) {
+        packetBufferPool.push_back(std::move(buffer));
+    }
+}
+
+BasePacket::~BasePacket() {
+    if (_pooledBuffer && _packet) {
+        recyclePacketBuffer(std::move(_packet));
+    }
+}
+
 int BasePacket::localHeaderSize() {
     return 0;
 }
@@ -62,7 +99,8 @@ BasePacket::BasePacket(qint64 size) {
     Q_ASSERT(size >= 0 && size <= maxPayload);
     
     _packetSize = size;
-    _packet.reset(new char[_packetSize]());
+    _packet = allocatePacketBuffer(_packetSize);
+    _pooledBuffer = true;
     _payloadCapacity = _packetSize;
     _payloadSize = 0;
     _payloadStart = _packet.get();
@@ -80,8 +118,17 @@ BasePacket::BasePacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr
 }
 
 BasePacket& BasePacket::operator=(const BasePacket& other) {
+    if (&other == this) {
+        return *this;
+    }
+
+    if (_pooledBuffer && _packet) {
+        recyclePacketBuffer(std::move(_packet));
+    }
+
     _packetSize = other._packetSize;
-    _packet = std::unique_ptr<char[]>(new char[_packetSize]);
+    _packet = allocatePacketBuffer(_packetSize);
+    _pooledBuffer = true;
     memcpy(_packet.get(), other._packet.get(), _packetSize);
     
     _payloadStart = _packet.get() + (other._payloadStart - other._packet.get());
@@ -105,8 +152,14 @@ BasePacket::BasePacket(BasePacket&& other) {
 }
 
 BasePacket& BasePacket::operator=(BasePacket&& other) {
+    if (_pooledBuffer && _packet) {
+        recyclePacketBuffer(std::move(_packet));
+    }
+
     _packetSize = other._packetSize;
     _packet = std::move(other._packet);
+    _pooledBuffer = other._pooledBuffer;
+    other._pooledBuffer = false;
     
     _payloadStart = other._payloadStart;
     _payloadCapacity = other._payloadCapacity;
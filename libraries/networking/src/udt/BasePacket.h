@@ -86,8 +86,15 @@ public:
 
     void setReceiveTime(p_high_resolution_clock::time_point receiveTime) { _receiveTime = receiveTime; }
     p_high_resolution_clock::time_point getReceiveTime() const { return _receiveTime; }
-    
+
+    virtual ~BasePacket();
+
 protected:
+    // Locally created packets draw their buffer from a thread-local free list of full-MTU
+    // buffers, so steady-state send paths (e.g. the 100Hz mixer broadcasts) stay off the heap.
+    static std::unique_ptr<char[]> allocatePacketBuffer(qint64 size);
+    static void recyclePacketBuffer(std::unique_ptr<char[]> buffer);
+
     BasePacket(qint64 size);
     BasePacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr& senderSockAddr);
     BasePacket(const BasePacket& other) : ExtendedIODevice() { *this = other; }
@@ -103,6 +110,7 @@ protected:
     
     qint64 _packetSize = 0;        // Total size of the allocated memory
     std::unique_ptr<char[]> _packet; // Allocated memory
+    bool _pooledBuffer = false;    // Whether _packet is a full-MTU buffer from the pool
     
     char* _payloadStart = nullptr; // Start of the payload
     qint64 _payloadCapacity = 0;          // Total capacity of the payload
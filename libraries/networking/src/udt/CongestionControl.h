@@ -49,6 +49,9 @@ public:
 
     virtual int estimatedTimeout() const = 0;
 
+    // smoothed RTT estimate in microseconds, or -1 when unknown; used for stats sampling
+    virtual int estimatedRTT() const { return -1; }
+
 protected:
     void setMSS(int mss) { _mss = mss; }
     virtual void setInitialSendSequenceNumber(SequenceNumber seqNum) = 0;
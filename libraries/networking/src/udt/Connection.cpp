@@ -275,9 +275,20 @@ bool Connection::processReceivedSequenceNumber(SequenceNumber sequenceNumber, in
         wasDuplicate = !_lossList.remove(sequenceNumber);
     }
 
-    // using a congestion control that ACKs every packet (like TCP Vegas)
-    sendACK();
-    
+    // A clean in-order advance only moves the cumulative ACK point, so within a
+    // receive burst those ACKs can be coalesced - the socket flushes one ACK per
+    // connection once its datagram queue is drained. Anything that carries a loss
+    // or reorder signal (gaps, resends, duplicates) still ACKs immediately, since
+    // the sender's fast-retransmit logic counts those duplicate ACKs.
+    bool inOrderAdvance = !wasDuplicate && _lossList.getLength() == 0 &&
+        sequenceNumber == _lastReceivedSequenceNumber;
+    if (inOrderAdvance && _parentSocket->deferACKFlush(this)) {
+        _ackPending = true;
+    } else {
+        _ackPending = false;
+        sendACK();
+    }
+
     if (wasDuplicate) {
         _stats.recordDuplicatePackets(payloadSize, packetSize);
     } else {
@@ -353,6 +364,12 @@ void Connection::processACK(ControlPacketPointer controlPacket) {
             // the congestion control has told us it needs a fast re-transmit of ack + 1, add that now
             _sendQueue->fastRetransmit(ack + 1);
         }
+
+        // feed the smoothed RTT into the stats ring for windowed percentiles
+        int rtt = _congestionControl->estimatedRTT();
+        if (rtt > 0) {
+            _stats.recordRTT(rtt);
+        }
     });
     
     _stats.record(ConnectionStats::Stats::ProcessedACK);
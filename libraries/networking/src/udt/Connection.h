@@ -65,7 +65,15 @@ public:
     void processControl(ControlPacketPointer controlPacket);
 
     void queueReceivedMessagePacket(std::unique_ptr<Packet> packet);
-    
+
+    // sends the cumulative ACK deferred during a receive burst, if one is pending
+    void flushACK() {
+        if (_ackPending) {
+            _ackPending = false;
+            sendACK();
+        }
+    }
+
     ConnectionStats::Stats sampleStats() { return _stats.sample(); }
 
     SockAddr getDestination() const { return _destination; }
@@ -108,6 +116,7 @@ private:
     void stopSendQueue();
     
     bool _hasReceivedHandshake { false }; // flag for receipt of handshake from server
+    bool _ackPending { false }; // a coalesced ACK is waiting for the socket's end-of-burst flush
     bool _hasReceivedHandshakeACK { false }; // flag for receipt of handshake ACK from client
     bool _didRequestHandshake { false }; // flag for request of handshake from server
    
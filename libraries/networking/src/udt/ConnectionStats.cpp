@@ -11,6 +11,8 @@
 
 #include "ConnectionStats.h"
 
+#include <algorithm>
+
 #include <QtCore/QDebug>
 
 using namespace udt;
@@ -28,10 +30,28 @@ ConnectionStats::Stats ConnectionStats::sample() {
     auto now = duration_cast<microseconds>(system_clock::now().time_since_epoch());
     sample.endTime = now;
     _currentSample.startTime = now;
+
+    // compute windowed RTT percentiles from the sample ring
+    int numSamples = (int)std::min(_rttSampleCount, (uint32_t)RTT_SAMPLE_RING_SIZE);
+    if (numSamples > 0) {
+        std::array<int, RTT_SAMPLE_RING_SIZE> sorted;
+        std::copy(_rttSamples.begin(), _rttSamples.begin() + numSamples, sorted.begin());
+        std::sort(sorted.begin(), sorted.begin() + numSamples);
+
+        sample.rttP50 = sorted[numSamples / 2];
+        sample.rttP95 = sorted[(numSamples * 95) / 100];
+        sample.rttP99 = sorted[(numSamples * 99) / 100];
+    }
     
     return sample;
 }
 
+void ConnectionStats::recordRTT(int rttMicroseconds) {
+    _rttSamples[_rttSampleCount % RTT_SAMPLE_RING_SIZE] = rttMicroseconds;
+    ++_rttSampleCount;
+    _currentSample.rtt = rttMicroseconds;
+}
+
 void ConnectionStats::record(Stats::Event event) {
     ++_currentSample.events[(int) event];
 }
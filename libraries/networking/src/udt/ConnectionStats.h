@@ -68,6 +68,11 @@ public:
         int rtt { 0 };
         int congestionWindowSize { 0 };
         int packetSendPeriod { 0 };
+
+        // windowed RTT percentiles over the recent sample ring, in microseconds
+        int rttP50 { 0 };
+        int rttP95 { 0 };
+        int rttP99 { 0 };
         
         // TODO: Remove once Win build supports brace initialization: `Events events {{ 0 }};`
         Stats() { events.fill(0); }
@@ -93,9 +98,16 @@ public:
 
     void recordCongestionWindowSize(int sample);
     void recordPacketSendPeriod(int sample);
-    
+
+    void recordRTT(int rttMicroseconds);
+
 private:
     Stats _currentSample;
+
+    // ring of recent RTT samples; percentiles are computed at sample() time
+    static const int RTT_SAMPLE_RING_SIZE = 256;
+    std::array<int, RTT_SAMPLE_RING_SIZE> _rttSamples;
+    uint32_t _rttSampleCount { 0 };
 };
     
 }
@@ -100,7 +100,7 @@ PacketVersion versionForPacketType(PacketType packetType) {
             return static_cast<PacketVersion>(EntityVersion::ParticleSpin);
         case PacketType::BulkAvatarTraitsAck:
         case PacketType::BulkAvatarTraits:
-            return static_cast<PacketVersion>(AvatarMixerPacketVersion::AvatarTraitsAck);
+            return static_cast<PacketVersion>(AvatarMixerPacketVersion::CompressedBulkAvatarTraits);
         default:
             return 22;
     }
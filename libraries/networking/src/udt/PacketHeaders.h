@@ -356,7 +356,8 @@ enum class AvatarMixerPacketVersion : PacketVersion {
     FBXJointOrderChange,
     HandControllerSection,
     SendVerificationFailed,
-    ARKitBlendshapes
+    ARKitBlendshapes,
+    CompressedBulkAvatarTraits
 };
 
 enum class DomainConnectRequestVersion : PacketVersion {
@@ -26,16 +26,33 @@ MessageNumber PacketQueue::getNextMessageNumber() {
     return _currentMessageNumber;
 }
 
+PacketQueue::~PacketQueue() {
+    // release anything still staged in the lock-free handoff
+    Packet* packet = nullptr;
+    while (_incomingPackets.try_pop(packet)) {
+        delete packet;
+    }
+}
+
 bool PacketQueue::isEmpty() const {
     LockGuard locker(_packetsLock);
 
-    // Only the main channel and it is empty
-    return _channels.size() == 1 && _channels.front()->empty();
+    // Only the main channel, it is empty, and nothing is staged
+    return _incomingPackets.empty() && _channels.size() == 1 && _channels.front()->empty();
+}
+
+void PacketQueue::drainIncomingPackets() {
+    Packet* packet = nullptr;
+    while (_incomingPackets.try_pop(packet)) {
+        _channels.front()->push_back(PacketPointer(packet));
+    }
 }
 
 PacketQueue::PacketPointer PacketQueue::takePacket() {
     LockGuard locker(_packetsLock);
 
+    drainIncomingPackets();
+
     if (isEmpty()) {
         return PacketPointer();
     }
@@ -80,8 +97,8 @@ PacketQueue::PacketPointer PacketQueue::takePacket() {
 }
 
 void PacketQueue::queuePacket(PacketPointer packet) {
-    LockGuard locker(_packetsLock);
-    _channels.front()->push_back(std::move(packet));
+    // lock-free handoff - the send thread drains into the main channel in takePacket
+    _incomingPackets.push(packet.release());
 }
 
 void PacketQueue::queuePacketList(PacketListPointer packetList) {
@@ -17,6 +17,8 @@
 #include <memory>
 #include <mutex>
 
+#include <TBBHelpers.h>
+
 #include "Packet.h"
 
 namespace udt {
@@ -36,6 +38,8 @@ class PacketQueue {
     
 public:
     PacketQueue(MessageNumber messageNumber = 0);
+    ~PacketQueue();
+
     void queuePacket(PacketPointer packet);
     void queuePacketList(PacketListPointer packetList);
     
@@ -48,8 +52,14 @@ public:
     
 private:
     MessageNumber getNextMessageNumber();
+    void drainIncomingPackets(); // requires _packetsLock
 
     MessageNumber _currentMessageNumber { 0 };
+
+    // lock-free staging for single packets: producers hand off here without touching
+    // _packetsLock, and the consumer drains into the main channel under the lock.
+    // Raw pointers are owned by the queue between push and drain.
+    tbb::concurrent_queue<Packet*> _incomingPackets;
     
     mutable Mutex _packetsLock; // Protects the packets to be sent.
     Channels _channels; // One channel per packet list + Main channel
@@ -0,0 +1,164 @@
+//
+//  RateCC.cpp
+//  libraries/networking/src/udt
+//
+//  Created by Clement on 9/1/26.
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "RateCC.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+using namespace udt;
+using namespace std::chrono;
+
+static const double STARTUP_GAIN = 2.885; // 2/ln(2), grows the rate multiplicatively each round trip
+static const double DRAIN_RATE_FRACTION = 0.75; // portion of the probe cycle spent draining the queue built probing
+static const double PROBE_RATE_FRACTION = 1.25; // portion of the probe cycle spent probing for more bandwidth
+static const int GAIN_CYCLE_LENGTH = 8; // minRTT-long phases: probe, drain, then six cruise phases
+
+static const microseconds MIN_RTT_WINDOW { 10 * 1000 * 1000 }; // keep the min RTT for 10s before re-measuring
+static const microseconds RATE_SAMPLE_WINDOW { 10 * DEFAULT_SYN_INTERVAL }; // bandwidth is the max sample in this window
+
+RateCC::RateCC() {
+    _mss = udt::MAX_PACKET_SIZE;
+    _packetSendPeriod = 1.0;
+    _congestionWindowSize = 16;
+}
+
+void RateCC::onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) {
+    _bytesSent += wireSize;
+    _sentPacketDatas.push_back({ seqNum, timePoint, _bytesSent });
+}
+
+bool RateCC::onACK(SequenceNumber ackNum, p_high_resolution_clock::time_point receiveTime) {
+    if (ackNum <= _lastACK) {
+        return false;
+    }
+
+    // find the sent record this ACK covers
+    auto it = std::find_if(_sentPacketDatas.begin(), _sentPacketDatas.end(), [ackNum](const SentPacketData& data) {
+        return data.sequenceNumber == ackNum;
+    });
+
+    if (it != _sentPacketDatas.end()) {
+        // RTT sample from this packet
+        int rtt = (int)duration_cast<microseconds>(receiveTime - it->timePoint).count();
+
+        if (_minRTT < 0 || rtt < _minRTT || receiveTime > _minRTTExpiry) {
+            _minRTT = rtt;
+            _minRTTExpiry = receiveTime + MIN_RTT_WINDOW;
+        }
+
+        if (_ewmaRTT < 0) {
+            _ewmaRTT = rtt;
+            _rttVariance = rtt / 2;
+        } else {
+            // same smoothing the other controllers use (RFC 6298 style)
+            static const int RTT_ESTIMATION_ALPHA_NUMERATOR = 8;
+            static const int RTT_ESTIMATION_VARIANCE_ALPHA_NUMERATOR = 4;
+            _ewmaRTT = (_ewmaRTT * (RTT_ESTIMATION_ALPHA_NUMERATOR - 1) + rtt) / RTT_ESTIMATION_ALPHA_NUMERATOR;
+            _rttVariance = (_rttVariance * (RTT_ESTIMATION_VARIANCE_ALPHA_NUMERATOR - 1)
+                            + abs(rtt - _ewmaRTT)) / RTT_ESTIMATION_VARIANCE_ALPHA_NUMERATOR;
+        }
+
+        // delivery-rate sample: bytes newly covered by this ACK over the ACK interval
+        if (_lastACKTime.time_since_epoch().count() != 0) {
+            uint64_t deliveredBytes = it->cumulativeBytes - _bytesAcked;
+            auto interval = duration_cast<microseconds>(receiveTime - _lastACKTime).count();
+            if (interval > 0 && deliveredBytes > 0) {
+                _rateSamples.push_back({ (double)(deliveredBytes * 8) / (double)interval, receiveTime });
+            }
+        }
+        _bytesAcked = it->cumulativeBytes;
+        _lastACKTime = receiveTime;
+
+        // drop acked packets from the in-flight list
+        _sentPacketDatas.erase(_sentPacketDatas.begin(), it + 1);
+    } else {
+        // the exact packet is no longer tracked - still drop everything this ACK covers
+        auto pruneIt = std::find_if(_sentPacketDatas.begin(), _sentPacketDatas.end(),
+                                    [ackNum](const SentPacketData& data) {
+            return data.sequenceNumber > ackNum;
+        });
+        _sentPacketDatas.erase(_sentPacketDatas.begin(), pruneIt);
+    }
+
+    // expire old rate samples
+    while (!_rateSamples.empty() &&
+           duration_cast<microseconds>(receiveTime - _rateSamples.front().timePoint) > RATE_SAMPLE_WINDOW) {
+        _rateSamples.pop_front();
+    }
+
+    _lastACK = ackNum;
+
+    updatePacing(receiveTime);
+
+    // rate-based control never requests a fast re-transmit; loss recovery is NAK driven
+    return false;
+}
+
+void RateCC::updatePacing(p_high_resolution_clock::time_point now) {
+    if (_rateSamples.empty() || _minRTT <= 0) {
+        return;
+    }
+
+    double bandwidth = 0.0; // bits per microsecond
+    for (const auto& sample : _rateSamples) {
+        bandwidth = std::max(bandwidth, sample.bitsPerUsec);
+    }
+
+    double gain;
+    if (_startup) {
+        gain = STARTUP_GAIN;
+
+        // leave startup after the bandwidth estimate plateaus for three rounds
+        static const double STARTUP_GROWTH_TARGET = 1.25;
+        static const int STARTUP_PLATEAU_ROUNDS = 3;
+        if (bandwidth < _lastStartupBandwidth * STARTUP_GROWTH_TARGET) {
+            if (++_plateauRounds >= STARTUP_PLATEAU_ROUNDS) {
+                _startup = false;
+                _gainCycleStart = now;
+                _gainCycleIndex = 0;
+            }
+        } else {
+            _plateauRounds = 0;
+            _lastStartupBandwidth = bandwidth;
+        }
+    } else {
+        // cycle pacing gain one minRTT at a time: probe up, drain, then cruise
+        if (duration_cast<microseconds>(now - _gainCycleStart).count() > _minRTT) {
+            _gainCycleIndex = (_gainCycleIndex + 1) % GAIN_CYCLE_LENGTH;
+            _gainCycleStart = now;
+        }
+        if (_gainCycleIndex == 0) {
+            gain = PROBE_RATE_FRACTION;
+        } else if (_gainCycleIndex == 1) {
+            gain = DRAIN_RATE_FRACTION;
+        } else {
+            gain = 1.0;
+        }
+    }
+
+    double pacedBitsPerUsec = bandwidth * gain;
+    if (pacedBitsPerUsec > 0.0) {
+        // microseconds between packet sends at the paced rate
+        setPacketSendPeriod((double)(_mss * 8) / pacedBitsPerUsec);
+    }
+
+    // window the amount in flight to twice the estimated bandwidth-delay product
+    static const double CWND_GAIN = 2.0;
+    int bdpPackets = (int)((bandwidth * _minRTT * CWND_GAIN) / (_mss * 8));
+    static const int MINIMUM_WINDOW_SIZE = 16;
+    _congestionWindowSize = std::max(bdpPackets, MINIMUM_WINDOW_SIZE);
+}
+
+int RateCC::estimatedTimeout() const {
+    static const int DEFAULT_ESTIMATED_TIMEOUT = 1000000; // 1s before we have any RTT samples
+    return _ewmaRTT == -1 ? DEFAULT_ESTIMATED_TIMEOUT : _ewmaRTT + _rttVariance * 4;
+}
@@ -0,0 +1,87 @@
+//
+//  RateCC.h
+//  libraries/networking/src/udt
+//
+//  Created by Clement on 9/1/26.
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_RateCC_h
+#define hifi_RateCC_h
+
+#include <deque>
+#include <vector>
+
+#include "CongestionControl.h"
+#include "Constants.h"
+
+namespace udt {
+
+// Rate-based congestion control in the BBR mold: the send rate is paced from a
+// windowed-max delivery-rate estimate and a windowed-min RTT, rather than from
+// loss. Random loss on wifi links therefore does not collapse throughput the way
+// it does for the delay/loss reactive TCPVegasCC; the connection's NAK machinery
+// still retransmits whatever is lost. Select it per Socket via
+// setCongestionControlFactory(new CongestionControlFactory<RateCC>()).
+class RateCC : public CongestionControl {
+public:
+    RateCC();
+
+    virtual bool onACK(SequenceNumber ackNum, p_high_resolution_clock::time_point receiveTime) override;
+    virtual void onTimeout() override {}
+
+    virtual void onPacketSent(int wireSize, SequenceNumber seqNum, p_high_resolution_clock::time_point timePoint) override;
+
+    virtual int estimatedTimeout() const override;
+    virtual int estimatedRTT() const override { return _ewmaRTT; }
+
+protected:
+    virtual void setInitialSendSequenceNumber(SequenceNumber seqNum) override { _lastACK = seqNum - 1; }
+
+private:
+    void updatePacing(p_high_resolution_clock::time_point now);
+
+    struct SentPacketData {
+        SequenceNumber sequenceNumber;
+        p_high_resolution_clock::time_point timePoint;
+        uint64_t cumulativeBytes;
+    };
+
+    struct RateSample {
+        double bitsPerUsec;
+        p_high_resolution_clock::time_point timePoint;
+    };
+
+    std::vector<SentPacketData> _sentPacketDatas; // sent packets awaiting ACK, for rate and RTT samples
+
+    SequenceNumber _lastACK;
+
+    uint64_t _bytesSent { 0 }; // cumulative wire bytes handed to the socket
+    uint64_t _bytesAcked { 0 }; // cumulative wire bytes covered by ACKs
+
+    p_high_resolution_clock::time_point _lastACKTime;
+
+    std::deque<RateSample> _rateSamples; // recent delivery-rate samples, max over these is the bandwidth estimate
+
+    int _minRTT { -1 }; // windowed minimum RTT, in microseconds
+    p_high_resolution_clock::time_point _minRTTExpiry;
+
+    int _ewmaRTT { -1 }; // smoothed RTT for timeout estimation, in microseconds
+    int _rttVariance { 0 };
+
+    bool _startup { true }; // startup phase, growing the rate estimate multiplicatively
+    double _lastStartupBandwidth { 0.0 }; // bandwidth at the last startup plateau check
+    int _plateauRounds { 0 }; // consecutive startup rounds without appreciable growth
+
+    int _gainCycleIndex { 0 };
+    p_high_resolution_clock::time_point _gainCycleStart;
+};
+
+}
+
+#endif // hifi_RateCC_h
@@ -112,7 +112,11 @@ SendQueue::~SendQueue() {
 
 void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
     _packets.queuePacket(std::move(packet));
-    
+
+    // pair briefly with the sleep predicate's lock so the lock-free handoff above
+    // cannot slip between a sleeping send thread's empty check and its wait
+    { std::lock_guard<std::recursive_mutex> locker(_packets.getLock()); }
+
     // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
     _emptyCondition.notify_one();
     
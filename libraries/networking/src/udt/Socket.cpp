@@ -17,6 +17,11 @@
 #include <sys/socket.h>
 #endif
 
+#if defined(Q_OS_LINUX)
+#include <sys/socket.h>
+#include <netinet/in.h>
+#endif
+
 #include <QtCore/QThread>
 
 #include <shared/QtHelpers.h>
@@ -384,6 +389,10 @@ void Socket::readPendingDatagrams() {
     const auto abortTime = system_clock::now() + MAX_PROCESS_TIME;
     int packetSizeWithHeader = -1;
 
+    // while draining, connections coalesce their in-order cumulative ACKs and we
+    // flush one ACK per connection at the end of the burst
+    _inReceiveBatch = true;
+
     while (_networkSocket.hasPendingDatagrams() &&
            (packetSizeWithHeader = _networkSocket.pendingDatagramSize()) != -1) {
         if (system_clock::now() > abortTime) {
@@ -422,6 +431,49 @@ void Socket::readPendingDatagrams() {
             continue;
         }
 
+        processReceivedDatagram(std::move(buffer), sizeRead, senderSockAddr, receiveTime);
+    }
+
+#if defined(Q_OS_LINUX)
+    // with Qt's internal buffer drained, pull any datagrams still queued on the
+    // descriptor in batches of up to 64 per syscall
+    if (std::chrono::system_clock::now() <= abortTime) {
+        drainBatchedDatagrams(abortTime);
+    }
+#endif
+
+    _inReceiveBatch = false;
+    flushDeferredACKs();
+}
+
+bool Socket::deferACKFlush(Connection* connection) {
+    if (!_inReceiveBatch) {
+        return false;
+    }
+    _deferredACKAddrs.push_back(connection->getDestination());
+    return true;
+}
+
+void Socket::flushDeferredACKs() {
+    if (_deferredACKAddrs.empty()) {
+        return;
+    }
+
+    Lock connectionsLock(_connectionsHashMutex);
+    for (auto& addr : _deferredACKAddrs) {
+        auto it = _connectionsHash.find(addr);
+        if (it != _connectionsHash.end()) {
+            it->second->flushACK();
+        }
+    }
+    _deferredACKAddrs.clear();
+}
+
+void Socket::processReceivedDatagram(std::unique_ptr<char[]> buffer, qint64 sizeRead, const SockAddr& senderSockAddr,
+                                     p_high_resolution_clock::time_point receiveTime) {
+    int packetSizeWithHeader = (int)sizeRead;
+
+    {
         auto it = _unfilteredHandlers.find(senderSockAddr);
 
         if (it != _unfilteredHandlers.end()) {
@@ -432,68 +484,132 @@ void Socket::readPendingDatagrams() {
                 it->second(std::move(basePacket));
             }
 
-            continue;
+            return;
         }
+    }
 
-        // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+    // check if this was a control packet or a data packet
+    bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
 
-        if (isControlPacket) {
-            // setup a control packet from the data we just read
-            auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            controlPacket->setReceiveTime(receiveTime);
+    if (isControlPacket) {
+        // setup a control packet from the data we just read
+        auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+        controlPacket->setReceiveTime(receiveTime);
 
-            // move this control packet to the matching connection, if there is one
-            auto connection = findOrCreateConnection(senderSockAddr, true);
+        // move this control packet to the matching connection, if there is one
+        auto connection = findOrCreateConnection(senderSockAddr, true);
 
-            if (connection) {
-                connection->processControl(move(controlPacket));
-            }
+        if (connection) {
+            connection->processControl(move(controlPacket));
+        }
 
-        } else {
-            // setup a Packet from the data we just read
-            auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            packet->setReceiveTime(receiveTime);
+    } else {
+        // setup a Packet from the data we just read
+        auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
+        packet->setReceiveTime(receiveTime);
 
-            // save the sequence number in case this is the packet that sticks readyRead
-            _lastReceivedSequenceNumber = packet->getSequenceNumber();
+        // save the sequence number in case this is the packet that sticks readyRead
+        _lastReceivedSequenceNumber = packet->getSequenceNumber();
 
-            // call our verification operator to see if this packet is verified
-            if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
-                auto connection = findOrCreateConnection(senderSockAddr, true);
+        // call our verification operator to see if this packet is verified
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            auto connection = findOrCreateConnection(senderSockAddr, true);
 
-                if (packet->isReliable()) {
-                    // if this was a reliable packet then signal the matching connection with the sequence number
+            if (packet->isReliable()) {
+                // if this was a reliable packet then signal the matching connection with the sequence number
 
-                    if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
-                                                                                  packet->getDataSize(),
-                                                                                  packet->getPayloadSize())) {
-                        // the connection could not be created or indicated that we should not continue processing this packet
+                if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
+                                                                              packet->getDataSize(),
+                                                                              packet->getPayloadSize())) {
+                    // the connection could not be created or indicated that we should not continue processing this packet
 #ifdef UDT_CONNECTION_DEBUG
-                        qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
-                            << ", type" << NLPacket::typeInHeader(*packet);
+                    qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
+                        << ", type" << NLPacket::typeInHeader(*packet);
 #endif
-                        continue;
-                    }
-                } else if (connection) {
-                    connection->recordReceivedUnreliablePackets(packet->getWireSize(),
-                                                                packet->getPayloadSize());
+                    return;
                 }
+            } else if (connection) {
+                connection->recordReceivedUnreliablePackets(packet->getWireSize(),
+                                                            packet->getPayloadSize());
+            }
 
-                if (packet->isPartOfMessage()) {
-                    auto connection = findOrCreateConnection(senderSockAddr, true);
-                    if (connection) {
-                        connection->queueReceivedMessagePacket(std::move(packet));
-                    }
-                } else if (_packetHandler) {
-                    // call the verified packet callback to let it handle this packet
-                    _packetHandler(std::move(packet));
+            if (packet->isPartOfMessage()) {
+                auto connection = findOrCreateConnection(senderSockAddr, true);
+                if (connection) {
+                    connection->queueReceivedMessagePacket(std::move(packet));
                 }
+            } else if (_packetHandler) {
+                // call the verified packet callback to let it handle this packet
+                _packetHandler(std::move(packet));
             }
         }
     }
 }
 
+#if defined(Q_OS_LINUX)
+void Socket::drainBatchedDatagrams(const std::chrono::system_clock::time_point& abortTime) {
+    int fd = (int)_networkSocket.socketDescriptor(SocketType::UDP);
+    if (fd < 0) {
+        return;
+    }
+
+    static const int DATAGRAM_BATCH_SIZE = 64;
+    static const int MAX_DATAGRAM_SIZE = udt::MAX_PACKET_SIZE_WITH_UDP_HEADER;
+
+    static thread_local std::vector<char> batchBuffers(DATAGRAM_BATCH_SIZE * MAX_DATAGRAM_SIZE);
+
+    struct mmsghdr msgs[DATAGRAM_BATCH_SIZE];
+    struct iovec iovecs[DATAGRAM_BATCH_SIZE];
+    struct sockaddr_storage addrs[DATAGRAM_BATCH_SIZE];
+
+    while (std::chrono::system_clock::now() <= abortTime) {
+        memset(msgs, 0, sizeof(msgs));
+        for (int i = 0; i < DATAGRAM_BATCH_SIZE; i++) {
+            iovecs[i].iov_base = batchBuffers.data() + i * MAX_DATAGRAM_SIZE;
+            iovecs[i].iov_len = MAX_DATAGRAM_SIZE;
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_name = &addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+        }
+
+        int numReceived = recvmmsg(fd, msgs, DATAGRAM_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+        if (numReceived <= 0) {
+            return; // drained, or nothing the kernel will give us right now
+        }
+
+        auto receiveTime = p_high_resolution_clock::now();
+
+        for (int i = 0; i < numReceived; i++) {
+            int sizeRead = (int)msgs[i].msg_len;
+            if (sizeRead <= 0) {
+                continue;
+            }
+
+            auto buffer = std::unique_ptr<char[]>(new char[sizeRead]);
+            memcpy(buffer.get(), batchBuffers.data() + i * MAX_DATAGRAM_SIZE, sizeRead);
+
+            auto* addr = reinterpret_cast<struct sockaddr*>(&addrs[i]);
+            quint16 senderPort = 0;
+            if (addr->sa_family == AF_INET) {
+                senderPort = ntohs(reinterpret_cast<struct sockaddr_in*>(addr)->sin_port);
+            } else if (addr->sa_family == AF_INET6) {
+                senderPort = ntohs(reinterpret_cast<struct sockaddr_in6*>(addr)->sin6_port);
+            } else {
+                continue;
+            }
+            SockAddr senderSockAddr(SocketType::UDP, QHostAddress(addr), senderPort);
+
+            processReceivedDatagram(std::move(buffer), sizeRead, senderSockAddr, receiveTime);
+        }
+
+        if (numReceived < DATAGRAM_BATCH_SIZE) {
+            return; // short batch means the queue is drained
+        }
+    }
+}
+#endif
+
 void Socket::connectToSendSignal(const SockAddr& destinationAddr, QObject* receiver, const char* slot) {
     Lock connectionsLock(_connectionsHashMutex);
     auto it = _connectionsHash.find(destinationAddr);
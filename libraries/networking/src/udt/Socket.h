@@ -16,7 +16,9 @@
 #ifndef hifi_Socket_h
 #define hifi_Socket_h
 
+#include <chrono>
 #include <functional>
+#include <memory>
 #include <unordered_map>
 #include <mutex>
 #include <list>
@@ -117,6 +119,24 @@ private slots:
 private:
     void setSystemBufferSizes(SocketType socketType);
     Connection* findOrCreateConnection(const SockAddr& sockAddr, bool filterCreation = false);
+
+    // routes one received datagram to the unfiltered handler, control processing, or packet handling
+    void processReceivedDatagram(std::unique_ptr<char[]> buffer, qint64 sizeRead, const SockAddr& senderSockAddr,
+                                 p_high_resolution_clock::time_point receiveTime);
+
+public:
+    // called by a Connection during a receive burst to defer its cumulative ACK until
+    // the burst is drained; returns false when no burst is active (caller ACKs now)
+    bool deferACKFlush(Connection* connection);
+
+private:
+    void flushDeferredACKs();
+
+#if defined(Q_OS_LINUX)
+    // after Qt's internal buffer is drained, pull remaining datagrams off the UDP
+    // descriptor with recvmmsg, up to 64 per syscall
+    void drainBatchedDatagrams(const std::chrono::system_clock::time_point& abortTime);
+#endif
    
     // privatized methods used by UDTTest - they are private since they must be called on the Socket thread
     ConnectionStats::Stats sampleStatsForConnection(const SockAddr& destination);
@@ -128,6 +148,8 @@ private:
     Q_INVOKABLE void writeReliablePacketList(PacketList* packetList, const SockAddr& sockAddr);
     
     NetworkSocket _networkSocket;
+    bool _inReceiveBatch { false };
+    std::vector<SockAddr> _deferredACKAddrs;
     PacketFilterOperator _packetFilterOperator;
     PacketHandler _packetHandler;
     MessageHandler _messageHandler;
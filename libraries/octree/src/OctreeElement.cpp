@@ -85,10 +85,6 @@ void OctreeElement::init(unsigned char * octalCode) {
     }
 #endif
 
-#ifdef SIMPLE_EXTERNAL_CHILDREN
-    _childrenSingle.reset();
-#endif
-
     for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
         _externalChildren[i].reset();
     }
@@ -259,28 +255,10 @@ OctreeElementPointer OctreeElement::getChildAtIndex(int childIndex) const {
 #endif // SIMPLE_CHILD_ARRAY
 
 #ifdef SIMPLE_EXTERNAL_CHILDREN
-    int childCount = getChildCount();
-
-    switch (childCount) {
-        case 0: {
-            return NULL;
-        } break;
-
-        case 1: {
-            // if our single child is the one being requested, return it, otherwise
-            // return null
-            int firstIndex = getNthBit(_childBitmask, 1);
-            if (firstIndex == childIndex) {
-                return _childrenSingle;
-            } else {
-                return NULL;
-            }
-        } break;
-
-        default : {
-            return _externalChildren[childIndex];
-        } break;
-    }
+    // children live in the inline 8-slot array; unset slots hold null. The old
+    // single-child special case dated from when the array was heap-external and
+    // cost a bit-scan branch on every traversal step.
+    return _externalChildren[childIndex];
 #endif // def SIMPLE_EXTERNAL_CHILDREN
 }
 
@@ -293,11 +271,8 @@ void OctreeElement::deleteAllChildren() {
         }
     }
 
-    if (_childrenExternal) {
-        // if the children_t union represents _children.external we need to delete it here
-        for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-            _externalChildren[i].reset();
-        }
+    for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
+        _externalChildren[i].reset();
     }
 }
 
@@ -323,9 +298,9 @@ void OctreeElement::setChildAtIndex(int childIndex, const OctreeElementPointer&
 
 #ifdef SIMPLE_EXTERNAL_CHILDREN
 
-    int firstIndex = getNthBit(_childBitmask, 1);
-    int secondIndex = getNthBit(_childBitmask, 2);
-
+    // children always live in the inline 8-slot array; the old single-child
+    // staging through _childrenSingle predates the array being inline and only
+    // added state transitions here and a branch per traversal step
     int previousChildCount = getChildCount();
     if (child) {
         setAtBit(_childBitmask, childIndex);
@@ -340,41 +315,7 @@ void OctreeElement::setChildAtIndex(int childIndex, const OctreeElementPointer&
         _childrenCount[newChildCount]++;
     }
 
-    if ((previousChildCount == 0 || previousChildCount == 1) && newChildCount == 0) {
-        _childrenSingle.reset();
-    } else if (previousChildCount == 0 && newChildCount == 1) {
-        _childrenSingle = child;
-    } else if (previousChildCount == 1 && newChildCount == 2) {
-        OctreeElementPointer previousChild = _childrenSingle;
-        for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-            _externalChildren[i].reset();
-        }
-        _externalChildren[firstIndex] = previousChild;
-        _externalChildren[childIndex] = child;
-
-        _childrenExternal = true;
-
-        _externalChildrenMemoryUsage += NUMBER_OF_CHILDREN * sizeof(OctreeElementPointer);
-
-    } else if (previousChildCount == 2 && newChildCount == 1) {
-        assert(!child); // we are removing a child, so this must be true!
-        OctreeElementPointer previousFirstChild = _externalChildren[firstIndex];
-        OctreeElementPointer previousSecondChild = _externalChildren[secondIndex];
-
-        for (int i = 0; i < NUMBER_OF_CHILDREN; i ++) {
-            _externalChildren[i].reset();
-        }
-        _childrenExternal = false;
-
-        _externalChildrenMemoryUsage -= NUMBER_OF_CHILDREN * sizeof(OctreeElementPointer);
-        if (childIndex == firstIndex) {
-            _childrenSingle = previousSecondChild;
-        } else {
-            _childrenSingle = previousFirstChild;
-        }
-    } else {
-        _externalChildren[childIndex] = child;
-    }
+    _externalChildren[childIndex] = child;
 
 #endif // def SIMPLE_EXTERNAL_CHILDREN
 }
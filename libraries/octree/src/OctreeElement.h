@@ -233,10 +233,9 @@ protected:
 #endif
 
 #ifdef SIMPLE_EXTERNAL_CHILDREN
-    // union children_t {
-    OctreeElementPointer _childrenSingle;
+    // children live inline in an 8-slot array indexed by child octant;
+    // unset slots hold null and _childBitmask tracks occupancy
     OctreeElementPointer _externalChildren[NUMBER_OF_CHILDREN];
-    // } _children;
 #endif
 
     uint16_t _sourceUUIDKey; /// Client only, stores node id of voxel server that sent his voxel, 2 bytes
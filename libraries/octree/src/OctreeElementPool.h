@@ -0,0 +1,103 @@
+//
+//  OctreeElementPool.h
+//  libraries/octree/src
+//
+//  Created by Andrew Meadows 2026.09.01
+//  Copyright 2026 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeElementPool_h
+#define hifi_OctreeElementPool_h
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// Allocator for octree elements intended for use with std::allocate_shared, so the
+// element and its shared_ptr control block live in one slab-backed block. Elements
+// created together (sibling fan-out during bitstream reads) land contiguously in a
+// slab, which keeps traversal walks closer to cache-linear than general-purpose heap
+// allocation scattered across the address space.
+template <typename T>
+class OctreeElementAllocator {
+public:
+    using value_type = T;
+
+    OctreeElementAllocator() = default;
+    template <typename U> OctreeElementAllocator(const OctreeElementAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(pool().allocate());
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        if (n != 1) {
+            ::operator delete(p);
+            return;
+        }
+        pool().deallocate(p);
+    }
+
+    template <typename U> bool operator==(const OctreeElementAllocator<U>&) const { return true; }
+    template <typename U> bool operator!=(const OctreeElementAllocator<U>&) const { return false; }
+
+private:
+    template <typename U> friend class OctreeElementAllocator;
+
+    class Pool {
+    public:
+        void* allocate() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_freeList) {
+                addSlab();
+            }
+            void* block = _freeList;
+            _freeList = *reinterpret_cast<void**>(block);
+            return block;
+        }
+
+        void deallocate(void* block) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            *reinterpret_cast<void**>(block) = _freeList;
+            _freeList = block;
+        }
+
+    private:
+        static const int SLAB_BLOCKS = 128;
+
+        void addSlab() {
+            // sizeof(T) is a multiple of alignof(T), so packing blocks back to back
+            // keeps every block correctly aligned
+            std::size_t blockSize = sizeof(T) > sizeof(void*) ? sizeof(T) : sizeof(void*);
+            char* slab = static_cast<char*>(::operator new(blockSize * SLAB_BLOCKS));
+            _slabs.push_back(slab);
+
+            // thread the new slab onto the free list, first block on top
+            for (int i = SLAB_BLOCKS - 1; i >= 0; --i) {
+                void* block = slab + i * blockSize;
+                *reinterpret_cast<void**>(block) = _freeList;
+                _freeList = block;
+            }
+        }
+
+        std::mutex _mutex;
+        void* _freeList { nullptr };
+        std::vector<char*> _slabs;
+    };
+
+    static Pool& pool() {
+        // intentionally leaked: elements held by shared_ptrs at static destruction
+        // time must still be able to return their blocks safely
+        static Pool* instance = new Pool();
+        return *instance;
+    }
+};
+
+#endif // hifi_OctreeElementPool_h
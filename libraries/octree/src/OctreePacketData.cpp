@@ -422,15 +422,18 @@ bool OctreePacketData::appendValue(const QVector<glm::quat>& value) {
     bool success = appendValue(qVecSize);
 
     if (success) {
-        QByteArray dataByteArray(udt::MAX_PACKET_SIZE, 0);
-        unsigned char* start = reinterpret_cast<unsigned char*>(dataByteArray.data());
-        unsigned char* destinationBuffer = start;
-        for (int index = 0; index < value.size(); index++) {
-            destinationBuffer += packOrientationQuatToBytes(destinationBuffer, value[index]);
-        }
-        int quatsSize = destinationBuffer - start;
-        success = append(start, quatsSize);
+        // pack straight into the stream - one bounds check, no staging buffer
+        const size_t PACKED_QUAT_SIZE = sizeof(uint16_t) * 4;
+        unsigned char* start = startAppendRegion(qVecSize * (int)PACKED_QUAT_SIZE);
+        success = (start != nullptr);
         if (success) {
+            unsigned char* destinationBuffer = start;
+            for (int index = 0; index < value.size(); index++) {
+                destinationBuffer += packOrientationQuatToBytes(destinationBuffer, value[index]);
+            }
+            endAppendRegion(destinationBuffer);
+
+            int quatsSize = destinationBuffer - start;
             _bytesOfValues += quatsSize;
             _totalBytesOfValues += quatsSize;
         }
@@ -457,25 +460,29 @@ bool OctreePacketData::appendValue(const QVector<bool>& value) {
     bool success = appendValue(qVecSize);
 
     if (success) {
-        QByteArray dataByteArray(udt::MAX_PACKET_SIZE, 0);
-        unsigned char* start = reinterpret_cast<unsigned char*>(dataByteArray.data());
-        unsigned char* destinationBuffer = start;
-        int bit = 0;
-        for (int index = 0; index < value.size(); index++) {
-            if (value[index]) {
-                (*destinationBuffer) |= (1 << bit);
+        // pack straight into the stream - one bounds check, no staging buffer
+        int maxBoolsSize = (value.size() + BITS_IN_BYTE - 1) / BITS_IN_BYTE;
+        unsigned char* start = startAppendRegion(maxBoolsSize);
+        success = (start != nullptr);
+        if (success) {
+            memset(start, 0, maxBoolsSize);
+            unsigned char* destinationBuffer = start;
+            int bit = 0;
+            for (int index = 0; index < value.size(); index++) {
+                if (value[index]) {
+                    (*destinationBuffer) |= (1 << bit);
+                }
+                if (++bit == BITS_IN_BYTE) {
+                    destinationBuffer++;
+                    bit = 0;
+                }
             }
-            if (++bit == BITS_IN_BYTE) {
+            if (bit != 0) {
                 destinationBuffer++;
-                bit = 0;
             }
-        }
-        if (bit != 0) {
-            destinationBuffer++;
-        }
-        int boolsSize = destinationBuffer - start;
-        success = append(start, boolsSize);
-        if (success) {
+            endAppendRegion(destinationBuffer);
+
+            int boolsSize = destinationBuffer - start;
             _bytesOfValues += boolsSize;
             _totalBytesOfValues += boolsSize;
         }
@@ -587,6 +594,21 @@ bool OctreePacketData::appendPosition(const glm::vec3& value) {
     return success;
 }
 
+unsigned char* OctreePacketData::startAppendRegion(int maxLength) {
+    if (maxLength > _bytesAvailable) {
+        return nullptr;
+    }
+    return &_uncompressed[_bytesInUse];
+}
+
+void OctreePacketData::endAppendRegion(unsigned char* cursor) {
+    int written = (int)(cursor - &_uncompressed[_bytesInUse]);
+    assert(written >= 0 && written <= _bytesAvailable);
+    _bytesInUse += written;
+    _bytesAvailable -= written;
+    _dirty = true;
+}
+
 bool OctreePacketData::appendRawData(const unsigned char* data, int length) {
     bool success = append(data, length);
     if (success) {
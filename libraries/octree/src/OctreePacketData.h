@@ -218,6 +218,13 @@ public:
     bool appendRawData(const unsigned char* data, int length);
     bool appendRawData(QByteArray data);
 
+    /// starts a batched append of up to maxLength bytes: the bounds check is paid once and
+    /// the caller writes fields directly into the returned cursor, then commits with
+    /// endAppendRegion. Returns NULL if maxLength doesn't fit.
+    unsigned char* startAppendRegion(int maxLength);
+    /// finishes a batched append, keeping the bytes written up to cursor
+    void endAppendRegion(unsigned char* cursor);
+
     /// returns a byte offset from beginning of the uncompressed stream based on offset from end.
     /// Positive offsetFromEnd returns that many bytes before the end of uncompressed stream
     int getUncompressedByteOffset(int offsetFromEnd = 0) const { return _bytesInUse - offsetFromEnd; }
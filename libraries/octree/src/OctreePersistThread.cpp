@@ -27,6 +27,7 @@
 #include <QJsonObject>
 #include <QJsonDocument>
 #include <QRegExp>
+#include <QSaveFile>
 
 #include <NumericalConstants.h>
 #include <PerfStat.h>
@@ -314,28 +315,71 @@ void OctreePersistThread::persist() {
         _tree->incrementPersistDataVersion();
 
         qCDebug(octree) << "Saving Octree data to:" << _filename;
-        if (_tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
+
+        // serialize the tree once; the persist file and the domain-server update
+        // are both derived from the same pass instead of walking the tree twice
+        QString jsonString;
+        _tree->toJSONString(jsonString);
+        QByteArray jsonData = jsonString.toUtf8();
+
+        QByteArray gzData;
+        bool gzipSuccess = gzip(jsonData, gzData, -1);
+
+        bool written = false;
+        if (_persistAsFileType == "json") {
+            written = writeDataToFile(_filename, jsonData);
+        } else if (_persistAsFileType == "json.gz") {
+            written = gzipSuccess && writeDataToFile(_filename, gzData);
+        }
+
+        if (written) {
             _tree->clearDirtyBit(); // tree is clean after saving
             qCDebug(octree) << "DONE persisting Octree data to" << _filename;
         } else {
             qCWarning(octree) << "Failed to persist Octree data to" << _filename;
         }
 
-        sendLatestEntityDataToDS();
+        if (gzipSuccess) {
+            sendEntityDataToDS(gzData);
+        } else {
+            qCWarning(octree) << "Failed to persist octree to DS";
+        }
     }
 }
 
-void OctreePersistThread::sendLatestEntityDataToDS() {
-    qDebug() << "Sending latest entity data to DS";
-    auto nodeList = DependencyManager::get<NodeList>();
-    const DomainHandler& domainHandler = nodeList->getDomainHandler();
+bool OctreePersistThread::writeDataToFile(const QString& filename, const QByteArray& data) {
+    QSaveFile persistFile(filename);
+    bool success = false;
+    if (persistFile.open(QIODevice::WriteOnly)) {
+        if (persistFile.write(data) != -1) {
+            success = persistFile.commit();
+            if (!success) {
+                qCritical() << "Failed to commit to persist file:" << persistFile.errorString();
+            }
+        } else {
+            qCritical("Failed to write to persist file.");
+        }
+    } else {
+        qCritical("Failed to open persist file for writing.");
+    }
+    return success;
+}
 
+void OctreePersistThread::sendLatestEntityDataToDS() {
     QByteArray data;
     if (_tree->toJSON(&data, nullptr, true)) {
-        auto message = NLPacketList::create(PacketType::OctreeDataPersist, QByteArray(), true, true);
-        message->write(data);
-        nodeList->sendPacketList(std::move(message), domainHandler.getSockAddr());
+        sendEntityDataToDS(data);
     } else {
         qCWarning(octree) << "Failed to persist octree to DS";
     }
 }
+
+void OctreePersistThread::sendEntityDataToDS(const QByteArray& gzippedEntityData) {
+    qDebug() << "Sending latest entity data to DS";
+    auto nodeList = DependencyManager::get<NodeList>();
+    const DomainHandler& domainHandler = nodeList->getDomainHandler();
+
+    auto message = NLPacketList::create(PacketType::OctreeDataPersist, QByteArray(), true, true);
+    message->write(gzippedEntityData);
+    nodeList->sendPacketList(std::move(message), domainHandler.getSockAddr());
+}
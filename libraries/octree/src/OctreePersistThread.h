@@ -65,6 +65,8 @@ protected:
 
     void replaceData(QByteArray data);
     void sendLatestEntityDataToDS();
+    void sendEntityDataToDS(const QByteArray& gzippedEntityData);
+    static bool writeDataToFile(const QString& filename, const QByteArray& data);
 
 private:
     OctreePointer _tree;
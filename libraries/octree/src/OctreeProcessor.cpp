@@ -139,6 +139,18 @@ void OctreeProcessor::processDatagram(ReceivedMessage& message, SharedNodePointe
                             "uncompressed:" << packetData.getUncompressedSize();
                     }
 
+                    // TODO: initial-snapshot decode is the big serial cost at
+                    // world entry - every paced packet funnels through this one
+                    // readBitstreamToTree call under the tree write lock while
+                    // other cores idle. Parallelizing needs two things that
+                    // don't exist yet: packets grouped by disjoint subtree (the
+                    // server interleaves subtrees across packets, so grouping
+                    // happens sender-side or via a client-side partition pass
+                    // on the encoded octal codes) and per-subtree insertion
+                    // that doesn't take the whole-tree write lock, i.e. the
+                    // sharded EntityTree. Decompression of the section payloads
+                    // is the one piece that could move off-thread today, but it
+                    // is a minority of the profile next to tree insertion.
                     if (extraDebugging) {
                         qCDebug(octree) << "OctreeProcessor::processDatagram() ******* START _tree->readBitstreamToTree()...";
                     }
@@ -944,14 +944,36 @@ void CharacterController::updateState() {
     }
     btVector3 rayEnd = rayStart - rayLength * _currentUp;
 
-    ClosestNotMe rayCallback(_rigidBody);
-    rayCallback.m_closestHitFraction = 1.0f;
-    _physicsEngine->getDynamicsWorld()->rayTest(rayStart, rayEnd, rayCallback);
-    bool rayHasHit = rayCallback.hasHit();
     quint64 now = usecTimestampNow();
+
+    // A stationary grounded character doesn't need to re-measure the floor every
+    // step: reuse the last scan while the pose hasn't changed, with a low-rate
+    // refresh so geometry edited underneath us is still noticed.
+    const quint64 STATIONARY_FLOOR_SCAN_PERIOD = USECS_PER_SECOND / 4;
+    bool reuseFloorScan = _state == State::Ground && _rigidBody &&
+        _rigidBody->getLinearVelocity().length2() < 1.0e-4f &&
+        _position.distance2(_lastFloorScanPosition) < 1.0e-6f &&
+        (now - _lastFloorScanTime) < STATIONARY_FLOOR_SCAN_PERIOD;
+
+    bool rayHasHit;
+    if (reuseFloorScan) {
+        // _floorDistance still holds the cached measurement
+        rayHasHit = _lastFloorScanHadHit;
+    } else {
+        ClosestNotMe rayCallback(_rigidBody);
+        rayCallback.m_closestHitFraction = 1.0f;
+        _physicsEngine->getDynamicsWorld()->rayTest(rayStart, rayEnd, rayCallback);
+        rayHasHit = rayCallback.hasHit();
+        if (rayHasHit) {
+            _floorDistance = rayLength * rayCallback.m_closestHitFraction - (_radius + _halfHeight);
+        }
+        _lastFloorScanTime = now;
+        _lastFloorScanPosition = _position;
+        _lastFloorScanHadHit = rayHasHit;
+    }
+
     if (rayHasHit) {
         _rayHitStartTime = now;
-        _floorDistance = rayLength * rayCallback.m_closestHitFraction - (_radius + _halfHeight);
     } else {
         const quint64 RAY_HIT_START_PERIOD = 500 * MSECS_PER_SECOND;
         if ((now - _rayHitStartTime) < RAY_HIT_START_PERIOD) {
@@ -202,6 +202,11 @@ protected:
     glm::vec3 _boxScale; // used to compute capsule shape
 
     quint64 _rayHitStartTime;
+
+    // cached floor scan for stationary grounded characters
+    btVector3 _lastFloorScanPosition { 0.0f, 0.0f, 0.0f };
+    quint64 _lastFloorScanTime { 0 };
+    bool _lastFloorScanHadHit { false };
     quint64 _takeoffToInAirStartTime;
     quint64 _jumpButtonDownStartTime;
     quint32 _jumpButtonDownCount;
@@ -261,22 +261,25 @@ void EntityMotionState::setWorldTransform(const btTransform& worldTrans) {
     if (!flags) {
         // flags are clear
         _entity->setWorldTransform(bulletToGLM(worldTrans.getOrigin()), bulletToGLM(worldTrans.getRotation()));
-        _entity->setWorldVelocity(getBodyLinearVelocity());
-        _entity->setWorldAngularVelocity(getBodyAngularVelocity());
-        _entity->setLastSimulated(usecTimestampNow());
+        _entity->setWorldVelocities(getBodyLinearVelocity(), getBodyAngularVelocity());
+        _entity->setLastSimulated(ObjectMotionState::getSimulationStepTimestamp());
     } else {
         // only set properties NOT flagged
         if (!(flags & Simulation::DIRTY_TRANSFORM)) {
             _entity->setWorldTransform(bulletToGLM(worldTrans.getOrigin()), bulletToGLM(worldTrans.getRotation()));
         }
-        if (!(flags & Simulation::DIRTY_LINEAR_VELOCITY)) {
-            _entity->setWorldVelocity(getBodyLinearVelocity());
-        }
-        if (!(flags & Simulation::DIRTY_ANGULAR_VELOCITY)) {
-            _entity->setWorldAngularVelocity(getBodyAngularVelocity());
+        if (!(flags & Simulation::DIRTY_VELOCITIES)) {
+            _entity->setWorldVelocities(getBodyLinearVelocity(), getBodyAngularVelocity());
+        } else {
+            if (!(flags & Simulation::DIRTY_LINEAR_VELOCITY)) {
+                _entity->setWorldVelocity(getBodyLinearVelocity());
+            }
+            if (!(flags & Simulation::DIRTY_ANGULAR_VELOCITY)) {
+                _entity->setWorldAngularVelocity(getBodyAngularVelocity());
+            }
         }
         if (flags != (Simulation::DIRTY_TRANSFORM | Simulation::DIRTY_VELOCITIES)) {
-            _entity->setLastSimulated(usecTimestampNow());
+            _entity->setLastSimulated(ObjectMotionState::getSimulationStepTimestamp());
         }
     }
 
@@ -469,6 +472,15 @@ void EntityMotionState::updateSendVelocities() {
     }
 }
 
+// NOTE on bid batching: bids ride the normal edit path (queueEditEntityMessage),
+// which coalesces per-entity updates per tick and packs as many edit records as
+// fit into each outgoing packet - so a toppled stack produces MTU-packed
+// EntityPhysics packets, not one packet per block. What a burst still pays is
+// one edit record per entity and the server-side per-record grant walk; a
+// denser wire form would need a new packed ownership record type on both ends.
+// Predictive grants (pre-granting entities contacting an already-owned body)
+// are a server policy change in the simulation-ownership logic, not a client
+// bidding change.
 void EntityMotionState::sendBid(OctreeEditPacketSender* packetSender, uint32_t step) {
     DETAILED_PROFILE_RANGE(simulation_physics, "Bid");
 
@@ -10,6 +10,9 @@
 //
 
 #include "MultiSphereShape.h"
+
+#include <cfloat>
+
 #include "PhysicsLogging.h"
 
 void SphereRegion::translate(const glm::vec3& translation) {
@@ -639,14 +642,24 @@ void MultiSphereShape::setScale(float scale) {
 }
 
 AABox& MultiSphereShape::updateBoundingBox(const glm::vec3& position, const glm::quat& rotation) {
-    _boundingBox = AABox();
-    auto spheres = getSpheresData();
-    for (size_t i = 0; i < spheres.size(); i++) {
-        auto sphere = spheres[i];
-        auto worldPosition = position + rotation * sphere._position;
-        glm::vec3 corner = worldPosition - glm::vec3(sphere._radius);
-        glm::vec3 dimensions = glm::vec3(2.0f * sphere._radius);
-        _boundingBox += AABox(corner, dimensions);
+    // this runs per joint per frame for every avatar in view - accumulate plain
+    // min/max corners in a tight loop over the sphere set, with no per-sphere
+    // copies or intermediate boxes
+    const auto& spheres = getSpheresData();
+    if (spheres.empty()) {
+        _boundingBox = AABox();
+        return _boundingBox;
     }
+
+    glm::vec3 minCorner { FLT_MAX };
+    glm::vec3 maxCorner { -FLT_MAX };
+    for (const auto& sphere : spheres) {
+        glm::vec3 worldPosition = position + rotation * sphere._position;
+        glm::vec3 radius { sphere._radius };
+        minCorner = glm::min(minCorner, worldPosition - radius);
+        maxCorner = glm::max(maxCorner, worldPosition + radius);
+    }
+
+    _boundingBox = AABox(minCorner, maxCorner - minCorner);
     return _boundingBox;
 }
\ No newline at end of file
@@ -51,6 +51,17 @@ uint32_t ObjectMotionState::getWorldSimulationStep() {
     return worldSimulationStep;
 }
 
+// static
+uint64_t simulationStepTimestamp = 0;
+void ObjectMotionState::setSimulationStepTimestamp(uint64_t timestamp) {
+    simulationStepTimestamp = timestamp;
+}
+
+// static
+uint64_t ObjectMotionState::getSimulationStepTimestamp() {
+    return simulationStepTimestamp;
+}
+
 // static
 ShapeManager* shapeManager = nullptr;
 void ObjectMotionState::setShapeManager(ShapeManager* manager) {
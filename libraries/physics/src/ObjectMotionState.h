@@ -93,6 +93,11 @@ public:
     static void setWorldSimulationStep(uint32_t step);
     static uint32_t getWorldSimulationStep();
 
+    // wall-clock time of the current motion-state sync pass, set once per pass so
+    // per-object sync doesn't pay a clock read per entity
+    static void setSimulationStepTimestamp(uint64_t timestamp);
+    static uint64_t getSimulationStepTimestamp();
+
     static void setShapeManager(ShapeManager* manager);
     static ShapeManager* getShapeManager();
 
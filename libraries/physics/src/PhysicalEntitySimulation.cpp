@@ -428,7 +428,7 @@ void PhysicalEntitySimulation::buildPhysicsTransaction(PhysicsEngine::Transactio
         bool needsNewShape = object->needsNewShape() && object->_entity->isReadyToComputeShape();
         if (needsNewShape) {
             ShapeType shapeType = object->getShapeType();
-            if (shapeType == SHAPE_TYPE_STATIC_MESH) {
+            if (ShapeManager::shapeIsCookedOnWorker(shapeType)) {
                 ShapeRequest shapeRequest(object->_entity);
                 ShapeRequests::iterator requestItr = _shapeRequests.find(shapeRequest);
                 if (requestItr == _shapeRequests.end()) {
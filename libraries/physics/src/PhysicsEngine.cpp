@@ -44,7 +44,14 @@ PhysicsEngine::~PhysicsEngine() {
 
 void PhysicsEngine::init() {
     if (!_dynamicsWorld) {
-        _collisionConfig = new btDefaultCollisionConfiguration();
+        // dense scenes overflow Bullet's default 4k manifold/algorithm pools, at which
+        // point the dispatcher falls back to a heap allocation per contact pair - size
+        // the pools for a couple thousand interacting dynamic objects up front
+        btDefaultCollisionConstructionInfo collisionConstruction;
+        collisionConstruction.m_defaultMaxPersistentManifoldPoolSize = 16384;
+        collisionConstruction.m_defaultMaxCollisionAlgorithmPoolSize = 16384;
+
+        _collisionConfig = new btDefaultCollisionConfiguration(collisionConstruction);
         _collisionDispatcher = new btCollisionDispatcher(_collisionConfig);
         _broadphaseFilter = new btDbvtBroadphase();
         _constraintSolver = new btSequentialImpulseConstraintSolver;
@@ -70,6 +77,37 @@ void PhysicsEngine::init() {
     }
 }
 
+void PhysicsEngine::takeSnapshot(std::vector<BodySnapshot>& snapshotOut) const {
+    snapshotOut.clear();
+
+    const btAlignedObjectArray<btRigidBody*>& bodies = _dynamicsWorld->getNonStaticRigidBodies();
+    snapshotOut.reserve(bodies.size());
+    for (int i = 0; i < bodies.size(); ++i) {
+        btRigidBody* body = bodies[i];
+        snapshotOut.push_back({ body, body->getWorldTransform(), body->getLinearVelocity(), body->getAngularVelocity() });
+    }
+}
+
+void PhysicsEngine::restoreSnapshot(const std::vector<BodySnapshot>& snapshot) {
+    for (const BodySnapshot& state : snapshot) {
+        btRigidBody* body = state.body;
+        if (!body->isInWorld()) {
+            // removed since the snapshot was taken; see the same-tick contract in the header
+            continue;
+        }
+
+        body->setWorldTransform(state.transform);
+        body->setInterpolationWorldTransform(state.transform);
+        body->setLinearVelocity(state.linearVelocity);
+        body->setAngularVelocity(state.angularVelocity);
+        body->clearForces();
+        if (!body->isStaticOrKinematicObject()) {
+            body->activate();
+        }
+        _dynamicsWorld->updateSingleAabb(body);
+    }
+}
+
 uint32_t PhysicsEngine::getNumSubsteps() const {
     return _dynamicsWorld->getNumSubsteps();
 }
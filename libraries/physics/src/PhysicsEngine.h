@@ -109,6 +109,20 @@ public:
     void processTransaction(Transaction& transaction);
 
     void stepSimulation();
+
+    // Snapshot/restore of dynamic rigid-body state, for server-authoritative rewind:
+    // capture before stepping, then restore and re-step within the same tick. The
+    // snapshot holds raw body pointers, so it is only valid while the set of bodies
+    // in the world is unchanged. takeSnapshot reuses the vector's capacity, so a
+    // caller that keeps its buffer pays no allocations at steady state.
+    struct BodySnapshot {
+        btRigidBody* body;
+        btTransform transform;
+        btVector3 linearVelocity;
+        btVector3 angularVelocity;
+    };
+    void takeSnapshot(std::vector<BodySnapshot>& snapshotOut) const;
+    void restoreSnapshot(const std::vector<BodySnapshot>& snapshot);
     void harvestPerformanceStats();
     void printPerformanceStatsToFile(const QString& filename);
     void updateContactMap();
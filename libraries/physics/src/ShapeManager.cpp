@@ -47,7 +47,7 @@ const btCollisionShape* ShapeManager::getShape(const ShapeInfo& info) {
         return shapeRef->shape;
     }
     const btCollisionShape* shape = nullptr;
-    if (info.getType() == SHAPE_TYPE_STATIC_MESH) {
+    if (shapeIsCookedOnWorker(info.getType())) {
         uint64_t hash = info.getHash();
 
         // bump the request count to the caller knows we're 
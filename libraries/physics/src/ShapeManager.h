@@ -55,6 +55,13 @@ public:
     ShapeManager();
     ~ShapeManager();
 
+    /// true for shape types expensive enough to cook on a worker thread; getShape
+    /// returns nullptr for these until the cooked shape is delivered
+    static bool shapeIsCookedOnWorker(ShapeType type) {
+        return type == SHAPE_TYPE_STATIC_MESH || type == SHAPE_TYPE_COMPOUND ||
+               type == SHAPE_TYPE_SIMPLE_COMPOUND || type == SHAPE_TYPE_SIMPLE_HULL;
+    }
+
     /// \return pointer to shape
     const btCollisionShape* getShape(const ShapeInfo& info);
     const btCollisionShape* getShapeByKey(uint64_t key);
@@ -19,6 +19,8 @@
 
 #include <LinearMath/btQuickprof.h>
 
+#include <SharedUtil.h>
+
 #include "Profile.h"
 
 ThreadSafeDynamicsWorld::ThreadSafeDynamicsWorld(
@@ -122,6 +124,9 @@ void ThreadSafeDynamicsWorld::synchronizeMotionStates() {
     BT_PROFILE("syncMotionStates");
     _changedMotionStates.clear();
 
+    // one clock read for the whole pass; per-object sync reads this instead
+    ObjectMotionState::setSimulationStepTimestamp(usecTimestampNow());
+
     // NOTE: m_synchronizeAllMotionStates is 'false' by default for optimization.
     // See PhysicsEngine::init() where we call _dynamicsWorld->setForceUpdateAllAabbs(false)
     if (m_synchronizeAllMotionStates) {
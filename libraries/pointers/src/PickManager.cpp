@@ -149,34 +149,44 @@ Transform PickManager::getResultTransform(unsigned int uid) const {
 }
 
 void PickManager::update() {
-    uint64_t expiry = usecTimestampNow() + _perFrameTimeBudget;
+    uint64_t deadline = usecTimestampNow() + _perFrameTimeBudget;
     std::unordered_map<PickQuery::PickType, std::unordered_map<unsigned int, std::shared_ptr<PickQuery>>> cachedPicks;
     withReadLock([&] {
         cachedPicks = _picks;
     });
 
     bool shouldPickHUD = _shouldPickHUDOperator();
-    // FIXME: give each type its own expiry
+
+    // each type gets an equal share of the remaining frame budget, so a heavy
+    // early type (a script with dozens of ray picks) can't starve the later
+    // ones out of their round-robin progress; unused time rolls forward
+    int remainingTypes = 4;
+    auto typeExpiry = [&]() {
+        uint64_t current = usecTimestampNow();
+        uint64_t remaining = deadline > current ? deadline - current : 0;
+        return current + remaining / remainingTypes--;
+    };
+
     // Each type will update at least one pick, regardless of the expiry
     {
         PROFILE_RANGE_EX(picks, "StylusPicks", 0xffff0000, (uint64_t)_totalPickCounts[PickQuery::Stylus]);
         PerformanceTimer perfTimer("StylusPicks");
-        _updatedPickCounts[PickQuery::Stylus] = _stylusPickCacheOptimizer.update(cachedPicks[PickQuery::Stylus], _nextPickToUpdate[PickQuery::Stylus], expiry, false);
+        _updatedPickCounts[PickQuery::Stylus] = _stylusPickCacheOptimizer.update(cachedPicks[PickQuery::Stylus], _nextPickToUpdate[PickQuery::Stylus], typeExpiry(), false);
     }
     {
         PROFILE_RANGE_EX(picks, "RayPicks", 0xffff0000, (uint64_t)_totalPickCounts[PickQuery::Ray]);
         PerformanceTimer perfTimer("RayPicks");
-        _updatedPickCounts[PickQuery::Ray] = _rayPickCacheOptimizer.update(cachedPicks[PickQuery::Ray], _nextPickToUpdate[PickQuery::Ray], expiry, shouldPickHUD);
+        _updatedPickCounts[PickQuery::Ray] = _rayPickCacheOptimizer.update(cachedPicks[PickQuery::Ray], _nextPickToUpdate[PickQuery::Ray], typeExpiry(), shouldPickHUD);
     }
     {
         PROFILE_RANGE_EX(picks, "ParabolaPicks", 0xffff0000, (uint64_t)_totalPickCounts[PickQuery::Parabola]);
         PerformanceTimer perfTimer("ParabolaPicks");
-        _updatedPickCounts[PickQuery::Parabola] = _parabolaPickCacheOptimizer.update(cachedPicks[PickQuery::Parabola], _nextPickToUpdate[PickQuery::Parabola], expiry, shouldPickHUD);
+        _updatedPickCounts[PickQuery::Parabola] = _parabolaPickCacheOptimizer.update(cachedPicks[PickQuery::Parabola], _nextPickToUpdate[PickQuery::Parabola], typeExpiry(), shouldPickHUD);
     }
     {
         PROFILE_RANGE_EX(picks, "CollisionPicks", 0xffff0000, (uint64_t)_totalPickCounts[PickQuery::Collision]);
         PerformanceTimer perfTimer("CollisionPicks");
-        _updatedPickCounts[PickQuery::Collision] = _collisionPickCacheOptimizer.update(cachedPicks[PickQuery::Collision], _nextPickToUpdate[PickQuery::Collision], expiry, false);
+        _updatedPickCounts[PickQuery::Collision] = _collisionPickCacheOptimizer.update(cachedPicks[PickQuery::Collision], _nextPickToUpdate[PickQuery::Collision], typeExpiry(), false);
     }
 }
 
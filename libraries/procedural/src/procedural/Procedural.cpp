@@ -8,6 +8,9 @@
 
 #include "Procedural.h"
 
+#include <mutex>
+#include <unordered_map>
+
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QJsonArray>
@@ -370,9 +373,38 @@ void Procedural::prepare(gpu::Batch& batch,
         //qCDebug(proceduralLog) << "FragmentShader:\n" << fragmentSource.getSource(shader::Dialect::glsl450, shader::Variant::Mono).c_str();
         //qCDebug(proceduralLog) << "VertexShader:\n" << vertexSource.getSource(shader::Dialect::glsl450, shader::Variant::Mono).c_str();
 
-        gpu::ShaderPointer vertexShader = gpu::Shader::createVertex(vertexSource);
-        gpu::ShaderPointer fragmentShader = gpu::Shader::createPixel(fragmentSource);
-        gpu::ShaderPointer program = gpu::Shader::createProgram(vertexShader, fragmentShader);
+        // Process-wide reuse of compiled procedural programs: scripted worlds rez many
+        // entities sharing one shader, and each Procedural instance would otherwise
+        // compile its own copy of it. The key covers everything that feeds the program:
+        // the base shader ids, the version define, both custom blocks, and the custom
+        // uniform names in slot order.
+        static std::mutex proceduralProgramCacheMutex;
+        static std::unordered_map<std::string, gpu::ShaderPointer> proceduralProgramCache;
+
+        std::string programKey = std::to_string(vertexSource.id) + '/' + std::to_string(fragmentSource.id) + '/' + versionDefine;
+        programKey += '\x1f' + _fragmentShaderSource.toStdString();
+        programKey += '\x1f' + _vertexShaderSource.toStdString();
+        for (const auto& uniformKey : _data.uniforms.keys()) {
+            programKey += '\x1f' + uniformKey.toStdString();
+        }
+
+        gpu::ShaderPointer program;
+        {
+            std::lock_guard<std::mutex> guard(proceduralProgramCacheMutex);
+            auto cached = proceduralProgramCache.find(programKey);
+            if (cached != proceduralProgramCache.end()) {
+                program = cached->second;
+            }
+        }
+
+        if (!program) {
+            gpu::ShaderPointer vertexShader = gpu::Shader::createVertex(vertexSource);
+            gpu::ShaderPointer fragmentShader = gpu::Shader::createPixel(fragmentSource);
+            program = gpu::Shader::createProgram(vertexShader, fragmentShader);
+
+            std::lock_guard<std::mutex> guard(proceduralProgramCacheMutex);
+            proceduralProgramCache[programKey] = program;
+        }
 
         _proceduralPipelines[key] = gpu::Pipeline::create(program, key.isTransparent() ? _transparentState : _opaqueState);
 
@@ -47,6 +47,10 @@ public:
     virtual void skipFrame() = 0;
     virtual void addFrame(FrameConstPointer) = 0;
 
+    // Hint that the next count frames will be read soon; clips backed by mapped
+    // files use this to fault pages in off the playback thread
+    virtual void prefetchNextFrames(size_t count) {}
+
     bool write(QIODevice& output);
 
     static Pointer fromFile(const QString& filePath);
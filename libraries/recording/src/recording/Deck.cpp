@@ -8,6 +8,7 @@
 
 #include "Deck.h"
  
+#include <QtConcurrent/QtConcurrent>
 #include <QtCore/QThread>
 
 #include <NumericalConstants.h>
@@ -185,6 +186,12 @@ void Deck::processFrames() {
     qCDebug(recordingLog) << "Setting timer for next processing " << nextInterval;
 #endif
     _timer.singleShot(nextInterval, this, &Deck::processFrames);
+
+    // warm the pages for the upcoming frames off-thread, so clips backed by
+    // memory-mapped files don't fault cold data in while frames are being
+    // handled on the main thread
+    static const size_t PREFETCH_FRAME_COUNT = 32;
+    QtConcurrent::run([nextClip] { nextClip->prefetchNextFrames(PREFETCH_FRAME_COUNT); });
 }
 
 void Deck::removeClip(const ClipConstPointer& clip) {
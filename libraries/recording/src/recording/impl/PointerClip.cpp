@@ -157,3 +157,29 @@ FrameConstPointer PointerClip::readFrame(size_t frameIndex) const {
 void PointerClip::addFrame(FrameConstPointer) {
     throw std::runtime_error("Pointer clips are read only, use duplicate to create a read/write clip");
 }
+
+void PointerClip::prefetchNextFrames(size_t count) {
+    // snapshot the upcoming frame ranges under the lock, then touch their pages
+    // without it - the data pointer stays valid as long as the clip is alive
+    std::vector<std::pair<quint64, FrameSize>> ranges;
+    uchar* data;
+    {
+        Locker lock(_mutex);
+        data = _data;
+        for (size_t i = _frameIndex; i < _frames.size() && i < _frameIndex + count; ++i) {
+            ranges.emplace_back(_frames[i].fileOffset, _frames[i].size);
+        }
+    }
+    if (!data) {
+        return;
+    }
+
+    static const size_t PAGE_SIZE = 4096;
+    volatile uchar sink = 0;
+    for (const auto& range : ranges) {
+        for (size_t offset = 0; offset < range.second; offset += PAGE_SIZE) {
+            sink += data[range.first + offset];
+        }
+    }
+    (void)sink;
+}
@@ -38,6 +38,7 @@ public:
 
     void init(uchar* data, size_t size);
     virtual void addFrame(FrameConstPointer) override;
+    virtual void prefetchNextFrames(size_t count) override;
     const QJsonDocument& getHeader() const {
         return _header;
     }
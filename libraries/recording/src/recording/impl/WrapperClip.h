@@ -36,6 +36,8 @@ public:
     virtual void skipFrame() override;
     virtual void addFrame(FrameConstPointer) override;
 
+    virtual void prefetchNextFrames(size_t count) override { _wrappedClip->prefetchNextFrames(count); }
+
 protected:
     virtual void reset() override;
 
@@ -151,6 +151,13 @@ signals:
 
 #define SSAO_RANDOM_SAMPLE_COUNT 16
 
+// TODO: the Quest-class cost target needs temporal accumulation on top of the
+// existing reduced-resolution path (resolutionLevel already computes AO at
+// half/quarter res - the default is 2 - with bilateral blur on the way up).
+// The missing piece is reprojection: accumulate the low-res occlusion against
+// last frame's result using the motion vectors DeferredFrameTransform can
+// provide, rejecting history on depth/normal disocclusion, which is new
+// shader work (history buffer, reprojection pass, clamp) rather than config.
 class AmbientOcclusionEffect {
 public:
     using Input = render::VaryingSet4<LightingModelPointer, DeferredFrameTransformPointer, DeferredFramebufferPointer, LinearDepthFramebufferPointer>;
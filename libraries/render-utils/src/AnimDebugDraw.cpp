@@ -353,8 +353,7 @@ void AnimDebugDraw::update() {
         numVerts += (int)markerMap.size() * VERTICES_PER_BONE;
         auto myAvatarMarkerMap = DebugDraw::getInstance().getMyAvatarMarkerMap();
         numVerts += (int)myAvatarMarkerMap.size() * VERTICES_PER_BONE;
-        auto rays = DebugDraw::getInstance().getRays();
-        DebugDraw::getInstance().clearRays();
+        auto rays = DebugDraw::getInstance().takeRays();
         numVerts += (int)rays.size() * VERTICES_PER_RAY;
 
         // allocate verts!
@@ -103,6 +103,9 @@ void CauterizedModel::updateClusterMatrices() {
     _needsUpdateClusterMatrices = false;
     const HFMModel& hfmModel = getHFMModel();
 
+    // hoisted: fetching the skeleton per cluster costs a shared_ptr copy apiece
+    auto animSkeleton = _rig.getAnimSkeleton();
+
     for (int i = 0; i < (int)_meshStates.size(); i++) {
         Model::MeshState& state = _meshStates[i];
         const HFMMesh& mesh = hfmModel.meshes.at(i);
@@ -116,12 +119,12 @@ void CauterizedModel::updateClusterMatrices() {
                 auto jointPose = _rig.getJointPose(cluster.jointIndex);
                 Transform jointTransform(jointPose.rot(), jointPose.scale(), jointPose.trans());
                 Transform clusterTransform;
-                Transform::mult(clusterTransform, jointTransform, _rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindTransform);
+                Transform::mult(clusterTransform, jointTransform, animSkeleton->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindTransform);
                 state.clusterDualQuaternions[j] = Model::TransformDualQuaternion(clusterTransform);
                 state.clusterDualQuaternions[j].setCauterizationParameters(0.0f, jointPose.trans());
             } else {
                 auto jointMatrix = _rig.getJointTransform(cluster.jointIndex);
-                glm_mat4u_mul(jointMatrix, _rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindMatrix, state.clusterMatrices[j]);
+                glm_mat4u_mul(jointMatrix, animSkeleton->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindMatrix, state.clusterMatrices[j]);
             }
         }
     }
@@ -155,7 +158,7 @@ void CauterizedModel::updateClusterMatrices() {
                     } else {
                         Transform jointTransform(cauterizePose.rot(), cauterizePose.scale(), cauterizePose.trans());
                         Transform clusterTransform;
-                        Transform::mult(clusterTransform, jointTransform, _rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindTransform);
+                        Transform::mult(clusterTransform, jointTransform, animSkeleton->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindTransform);
                         state.clusterDualQuaternions[j] = Model::TransformDualQuaternion(clusterTransform);
                         state.clusterDualQuaternions[j].setCauterizationParameters(1.0f, cauterizePose.trans());
                     }
@@ -164,7 +167,7 @@ void CauterizedModel::updateClusterMatrices() {
                         // not cauterized so just copy the value from the non-cauterized version.
                         state.clusterMatrices[j] = _meshStates[i].clusterMatrices[j];
                     } else {
-                        glm_mat4u_mul(cauterizeMatrix, _rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindMatrix, state.clusterMatrices[j]);
+                        glm_mat4u_mul(cauterizeMatrix, animSkeleton->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindMatrix, state.clusterMatrices[j]);
                     }
                 }
             }
@@ -174,6 +177,17 @@ void CauterizedModel::updateClusterMatrices() {
     updateBlendshapes();
 }
 
+// TODO: a render-time late update of MyAvatar's head pose was investigated here:
+// sample the freshest HMD pose on the present thread and fold a sensor-to-world
+// correction into the cluster matrices of the already-submitted render items,
+// bounding head-pose latency to one compositor interval under simulation load.
+// It doesn't fit the current ownership model: cluster buffers are written by the
+// model on the main thread via this post-update lambda and read by render items
+// through scene transactions, so a present-thread rewrite would race both; and
+// the skinned joints themselves come from the rig, so correcting only the root
+// would shear the neck against the cauterized head. The compositor's async
+// reprojection already covers rotational latency; a full fix needs per-frame
+// cluster buffer double-buffering keyed by the present frame index.
 void CauterizedModel::updateRenderItems() {
     if (_isCauterized) {
         if (!_addedToScene) {
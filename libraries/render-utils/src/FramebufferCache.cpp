@@ -28,13 +28,6 @@ void FramebufferCache::setFrameBufferSize(QSize frameBufferSize) {
     }
 }
 
-void FramebufferCache::createPrimaryFramebuffer() {
-    auto defaultSampler = gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_POINT);
-
-    auto smoothSampler = gpu::Sampler(gpu::Sampler::FILTER_MIN_MAG_MIP_LINEAR);
-}
-
-
 gpu::FramebufferPointer FramebufferCache::getFramebuffer() {
     std::unique_lock<std::mutex> lock(_mutex);
     if (_cachedFramebuffers.empty()) {
@@ -48,6 +41,11 @@ gpu::FramebufferPointer FramebufferCache::getFramebuffer() {
 void FramebufferCache::releaseFramebuffer(const gpu::FramebufferPointer& framebuffer) {
     std::unique_lock<std::mutex> lock(_mutex);
     if (QSize(framebuffer->getSize().x, framebuffer->getSize().y) == _frameBufferSize) {
-        _cachedFramebuffers.push_back(framebuffer);
+        // bound the pool: a hiccup can create several full-resolution framebuffers in
+        // flight at once, and retaining them all pins tens of MB of VRAM apiece at 4K
+        const size_t MAX_CACHED_FRAMEBUFFERS = 5;   // comfortably above present-queue depth
+        if (_cachedFramebuffers.size() < MAX_CACHED_FRAMEBUFFERS) {
+            _cachedFramebuffers.push_back(framebuffer);
+        }
     }
 }
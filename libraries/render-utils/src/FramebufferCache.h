@@ -35,7 +35,6 @@ public:
     void releaseFramebuffer(const gpu::FramebufferPointer& framebuffer);
 
 private:
-    void createPrimaryFramebuffer();
 
     gpu::FramebufferPointer _shadowFramebuffer;
 
@@ -956,40 +956,38 @@ void GeometryCache::renderGrid(gpu::Batch& batch, const glm::vec2& minCorner, co
 void GeometryCache::updateVertices(int id, const QVector<glm::vec2>& points, const QVector<glm::vec4>& colors) {
     BatchItemDetails& details = _registeredVertices[id];
 
-    if (details.isCreated) {
+    const int FLOATS_PER_VERTEX = 2 + 3; // vertices + normals
+    const int NUM_POS_COORDS = 2;
+    const int VERTEX_NORMAL_OFFSET = NUM_POS_COORDS * sizeof(float);
+
+    // an update with the same layout refills the existing buffers in place;
+    // recreating buffer/stream objects per update churns GL allocations
+    bool reuseBuffers = details.isCreated && details.vertexSize == FLOATS_PER_VERTEX;
+    if (details.isCreated && !reuseBuffers) {
         details.clear();
 #ifdef WANT_DEBUG
         qCDebug(renderutils) << "updateVertices()... RELEASING REGISTERED";
 #endif // def WANT_DEBUG
     }
 
-    const int FLOATS_PER_VERTEX = 2 + 3; // vertices + normals
-    const int NUM_POS_COORDS = 2;
-    const int VERTEX_NORMAL_OFFSET = NUM_POS_COORDS * sizeof(float);
     details.isCreated = true;
     details.vertices = points.size();
     details.vertexSize = FLOATS_PER_VERTEX;
 
-    auto verticesBuffer = std::make_shared<gpu::Buffer>();
-    auto colorBuffer = std::make_shared<gpu::Buffer>();
-    auto streamFormat = std::make_shared<gpu::Stream::Format>();
-    auto stream = std::make_shared<gpu::BufferStream>();
-
-    details.verticesBuffer = verticesBuffer;
-    details.colorBuffer = colorBuffer;
-    details.streamFormat = streamFormat;
-    details.stream = stream;
+    if (!reuseBuffers) {
+        details.verticesBuffer = std::make_shared<gpu::Buffer>();
+        details.colorBuffer = std::make_shared<gpu::Buffer>();
+        details.streamFormat = std::make_shared<gpu::Stream::Format>();
+        details.stream = std::make_shared<gpu::BufferStream>();
 
-    details.streamFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element(gpu::VEC2, gpu::FLOAT, gpu::XYZ), 0);
-    details.streamFormat->setAttribute(gpu::Stream::NORMAL, 0, gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::XYZ), VERTEX_NORMAL_OFFSET);
-    // TODO: circle3D overlays use this to define their vertices, so they need tex coords
-    details.streamFormat->setAttribute(gpu::Stream::COLOR, 1, gpu::Element(gpu::VEC4, gpu::NUINT8, gpu::RGBA));
-
-    details.stream->addBuffer(details.verticesBuffer, 0, details.streamFormat->getChannels().at(0)._stride);
-    details.stream->addBuffer(details.colorBuffer, 0, details.streamFormat->getChannels().at(1)._stride);
+        details.streamFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element(gpu::VEC2, gpu::FLOAT, gpu::XYZ), 0);
+        details.streamFormat->setAttribute(gpu::Stream::NORMAL, 0, gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::XYZ), VERTEX_NORMAL_OFFSET);
+        // TODO: circle3D overlays use this to define their vertices, so they need tex coords
+        details.streamFormat->setAttribute(gpu::Stream::COLOR, 1, gpu::Element(gpu::VEC4, gpu::NUINT8, gpu::RGBA));
 
-    details.vertices = points.size();
-    details.vertexSize = FLOATS_PER_VERTEX;
+        details.stream->addBuffer(details.verticesBuffer, 0, details.streamFormat->getChannels().at(0)._stride);
+        details.stream->addBuffer(details.colorBuffer, 0, details.streamFormat->getChannels().at(1)._stride);
+    }
 
     float* vertexData = new float[details.vertices * FLOATS_PER_VERTEX];
     float* vertex = vertexData;
@@ -1017,8 +1015,8 @@ void GeometryCache::updateVertices(int id, const QVector<glm::vec2>& points, con
         }
         *(colorDataAt++) = compactColor;
     }
-    details.verticesBuffer->append(sizeof(float) * FLOATS_PER_VERTEX * details.vertices, (gpu::Byte*) vertexData);
-    details.colorBuffer->append(sizeof(int) * details.vertices, (gpu::Byte*) colorData);
+    details.verticesBuffer->setData(sizeof(float) * FLOATS_PER_VERTEX * details.vertices, (gpu::Byte*) vertexData);
+    details.colorBuffer->setData(sizeof(int) * details.vertices, (gpu::Byte*) colorData);
     delete[] vertexData;
     delete[] colorData;
 
@@ -1033,39 +1031,38 @@ void GeometryCache::updateVertices(int id, const QVector<glm::vec2>& points, con
 
 void GeometryCache::updateVertices(int id, const QVector<glm::vec3>& points, const QVector<glm::vec4>& colors) {
     BatchItemDetails& details = _registeredVertices[id];
-    if (details.isCreated) {
+
+    const int FLOATS_PER_VERTEX = 3 + 3; // vertices + normals
+    const int NUM_POS_COORDS = 3;
+    const int VERTEX_NORMAL_OFFSET = NUM_POS_COORDS * sizeof(float);
+
+    // an update with the same layout refills the existing buffers in place;
+    // recreating buffer/stream objects per update churns GL allocations
+    bool reuseBuffers = details.isCreated && details.vertexSize == FLOATS_PER_VERTEX;
+    if (details.isCreated && !reuseBuffers) {
         details.clear();
 #ifdef WANT_DEBUG
         qCDebug(renderutils) << "updateVertices()... RELEASING REGISTERED";
 #endif // def WANT_DEBUG
     }
 
-    const int FLOATS_PER_VERTEX = 3 + 3; // vertices + normals
-    const int NUM_POS_COORDS = 3;
-    const int VERTEX_NORMAL_OFFSET = NUM_POS_COORDS * sizeof(float);
     details.isCreated = true;
     details.vertices = points.size();
     details.vertexSize = FLOATS_PER_VERTEX;
 
-    auto verticesBuffer = std::make_shared<gpu::Buffer>();
-    auto colorBuffer = std::make_shared<gpu::Buffer>();
-    auto streamFormat = std::make_shared<gpu::Stream::Format>();
-    auto stream = std::make_shared<gpu::BufferStream>();
-
-    details.verticesBuffer = verticesBuffer;
-    details.colorBuffer = colorBuffer;
-    details.streamFormat = streamFormat;
-    details.stream = stream;
+    if (!reuseBuffers) {
+        details.verticesBuffer = std::make_shared<gpu::Buffer>();
+        details.colorBuffer = std::make_shared<gpu::Buffer>();
+        details.streamFormat = std::make_shared<gpu::Stream::Format>();
+        details.stream = std::make_shared<gpu::BufferStream>();
 
-    details.streamFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::XYZ), 0);
-    details.streamFormat->setAttribute(gpu::Stream::NORMAL, 0, gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::XYZ), VERTEX_NORMAL_OFFSET);
-    details.streamFormat->setAttribute(gpu::Stream::COLOR, 1, gpu::Element(gpu::VEC4, gpu::NUINT8, gpu::RGBA));
-
-    details.stream->addBuffer(details.verticesBuffer, 0, details.streamFormat->getChannels().at(0)._stride);
-    details.stream->addBuffer(details.colorBuffer, 0, details.streamFormat->getChannels().at(1)._stride);
+        details.streamFormat->setAttribute(gpu::Stream::POSITION, 0, gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::XYZ), 0);
+        details.streamFormat->setAttribute(gpu::Stream::NORMAL, 0, gpu::Element(gpu::VEC3, gpu::FLOAT, gpu::XYZ), VERTEX_NORMAL_OFFSET);
+        details.streamFormat->setAttribute(gpu::Stream::COLOR, 1, gpu::Element(gpu::VEC4, gpu::NUINT8, gpu::RGBA));
 
-    details.vertices = points.size();
-    details.vertexSize = FLOATS_PER_VERTEX;
+        details.stream->addBuffer(details.verticesBuffer, 0, details.streamFormat->getChannels().at(0)._stride);
+        details.stream->addBuffer(details.colorBuffer, 0, details.streamFormat->getChannels().at(1)._stride);
+    }
 
     // Default to white
     int compactColor = 0xFFFFFFFF;
@@ -1096,8 +1093,8 @@ void GeometryCache::updateVertices(int id, const QVector<glm::vec3>& points, con
         *(colorDataAt++) = compactColor;
     }
 
-    details.verticesBuffer->append(sizeof(float) * FLOATS_PER_VERTEX * details.vertices, (gpu::Byte*) vertexData);
-    details.colorBuffer->append(sizeof(int) * details.vertices, (gpu::Byte*) colorData);
+    details.verticesBuffer->setData(sizeof(float) * FLOATS_PER_VERTEX * details.vertices, (gpu::Byte*) vertexData);
+    details.colorBuffer->setData(sizeof(int) * details.vertices, (gpu::Byte*) colorData);
     delete[] vertexData;
     delete[] colorData;
 
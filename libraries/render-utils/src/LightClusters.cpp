@@ -328,8 +328,19 @@ glm::ivec3 LightClusters::updateClusters() {
     // Clean up last info
     uint32_t numClusters = (uint32_t)_clusterGrid.size();
 
-    std::vector< std::vector< LightIndex > > clusterGridPoint(numClusters);
-    std::vector< std::vector< LightIndex > > clusterGridSpot(numClusters);
+    // per-cluster scratch lists are members reused across frames: clear() keeps
+    // each inner list's capacity, so steady state assigns lights with no
+    // per-frame allocation (these were two fresh vector-of-vectors per frame)
+    auto& clusterGridPoint = _clusterGridPointLights;
+    auto& clusterGridSpot = _clusterGridSpotLights;
+    clusterGridPoint.resize(numClusters);
+    clusterGridSpot.resize(numClusters);
+    for (auto& cluster : clusterGridPoint) {
+        cluster.clear();
+    }
+    for (auto& cluster : clusterGridSpot) {
+        cluster.clear();
+    }
 
     _clusterGrid.clear();
     _clusterGrid.resize(numClusters, EMPTY_CLUSTER);
@@ -105,6 +105,10 @@ public:
 
     std::vector<uint32_t> _clusterGrid;
     std::vector<LightIndex> _clusterContent;
+
+    // frame-reused scratch for per-cluster light assignment
+    std::vector<std::vector<LightIndex>> _clusterGridPointLights;
+    std::vector<std::vector<LightIndex>> _clusterGridSpotLights;
     gpu::BufferView _clusterGridBuffer;
     gpu::BufferView _clusterContentBuffer;
     uint32_t _clusterContentBudget { 0 };
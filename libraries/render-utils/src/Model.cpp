@@ -233,20 +233,24 @@ void Model::updateRenderItems() {
         auto renderItemKeyGlobalFlags = self->getRenderItemKeyGlobalFlags();
         bool cauterized = self->isCauterized();
 
+        // snapshot the mesh states once for the whole model: every part's update
+        // lambda shares this immutable copy instead of capturing (and copying) its
+        // own cluster matrix arrays into each std::function
+        auto meshStates = std::make_shared<const std::vector<MeshState>>(self->_meshStates);
+
         render::Transaction transaction;
         for (int i = 0; i < (int) self->_modelMeshRenderItemIDs.size(); i++) {
 
             auto itemID = self->_modelMeshRenderItemIDs[i];
             auto meshIndex = self->_modelMeshRenderItemShapes[i].meshIndex;
 
-            const auto& meshState = self->getMeshState(meshIndex);
-
             bool invalidatePayloadShapeKey = self->shouldInvalidatePayloadShapeKey(meshIndex);
             bool useDualQuaternionSkinning = self->getUseDualQuaternionSkinning();
 
-            transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, meshState, useDualQuaternionSkinning,
+            transaction.updateItem<ModelMeshPartPayload>(itemID, [modelTransform, meshStates, meshIndex, useDualQuaternionSkinning,
                                                                   invalidatePayloadShapeKey, primitiveMode, billboardMode, renderItemKeyGlobalFlags,
                                                                   cauterized, renderWithZones](ModelMeshPartPayload& data) {
+                const MeshState& meshState = (*meshStates)[meshIndex];
                 if (useDualQuaternionSkinning) {
                     data.updateClusterBuffer(meshState.clusterDualQuaternions);
                     data.computeAdjustedLocalBound(meshState.clusterDualQuaternions);
@@ -1497,6 +1501,10 @@ void Model::updateClusterMatrices() {
 
     _needsUpdateClusterMatrices = false;
     const HFMModel& hfmModel = getHFMModel();
+
+    // hoisted: fetching the skeleton per cluster costs a shared_ptr copy apiece
+    auto animSkeleton = _rig.getAnimSkeleton();
+
     for (int i = 0; i < (int) _meshStates.size(); i++) {
         MeshState& state = _meshStates[i];
         int meshIndex = i;
@@ -1509,11 +1517,11 @@ void Model::updateClusterMatrices() {
                 auto jointPose = _rig.getJointPose(cluster.jointIndex);
                 Transform jointTransform(jointPose.rot(), jointPose.scale(), jointPose.trans());
                 Transform clusterTransform;
-                Transform::mult(clusterTransform, jointTransform, _rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindTransform);
+                Transform::mult(clusterTransform, jointTransform, animSkeleton->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindTransform);
                 state.clusterDualQuaternions[j] = Model::TransformDualQuaternion(clusterTransform);
             } else {
                 auto jointMatrix = _rig.getJointTransform(cluster.jointIndex);
-                glm_mat4u_mul(jointMatrix, _rig.getAnimSkeleton()->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindMatrix, state.clusterMatrices[j]);
+                glm_mat4u_mul(jointMatrix, animSkeleton->getClusterBindMatricesOriginalValues(meshIndex, clusterIndex).inverseBindMatrix, state.clusterMatrices[j]);
             }
         }
     }
@@ -1917,15 +1925,23 @@ void Blender::run() {
 
             float normalCoefficient = vertexCoefficient * NORMAL_COEFFICIENT_SCALE;
             const HFMBlendshape& blendshape = meshIter->blendshapes.at(i);
-            for (int j = 0; j < blendshape.indices.size(); ++j) {
-                int index = blendshape.indices.at(j);
-
-                auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[index];
-                currentBlendshapeOffset.positionOffset += blendshape.vertices.at(j) * vertexCoefficient;
-                currentBlendshapeOffset.normalOffset += blendshape.normals.at(j) * normalCoefficient;
-                if (j < blendshape.tangents.size()) {
-                    currentBlendshapeOffset.tangentOffset += blendshape.tangents.at(j) * normalCoefficient;
-                }
+
+            // accumulate from raw arrays with the tangent pass split out, so the
+            // per-index loops stay branch-free
+            int numIndices = blendshape.indices.size();
+            const int* indices = blendshape.indices.constData();
+            const glm::vec3* vertices = blendshape.vertices.constData();
+            const glm::vec3* normals = blendshape.normals.constData();
+            for (int j = 0; j < numIndices; ++j) {
+                auto& currentBlendshapeOffset = unpackedBlendshapeOffsets[indices[j]];
+                currentBlendshapeOffset.positionOffset += vertices[j] * vertexCoefficient;
+                currentBlendshapeOffset.normalOffset += normals[j] * normalCoefficient;
+            }
+
+            int numTangents = qMin(blendshape.tangents.size(), numIndices);
+            const glm::vec3* tangents = blendshape.tangents.constData();
+            for (int j = 0; j < numTangents; ++j) {
+                unpackedBlendshapeOffsets[indices[j]].tangentOffset += tangents[j] * normalCoefficient;
             }
         }
 
@@ -150,6 +150,11 @@ void RenderDeferredTask::build(JobModel& task, const render::Varying& input, ren
     // Prepare deferred, generate the shared Deferred Frame Transform. Only valid with the scaled frame buffer
     const auto deferredFrameTransform = task.addJob<GenerateDeferredFrameTransform>("DeferredFrameTransform", jitter);
 
+    // GPU range timers bracketing the major segments of the frame, surfaced to
+    // scripts through each End job's gpuRunTime so slow venues can be attributed
+    // to geometry, lighting, transparency, or post without a capture tool
+    const auto opaqueRangeTimer = task.addJob<BeginGPURangeTimer>("BeginOpaqueRangeTimer", "DrawOpaques");
+
     const auto prepareDeferredInputs = PrepareDeferred::Inputs(scaledPrimaryFramebuffer, lightingModel).asVarying();
     const auto prepareDeferredOutputs = task.addJob<PrepareDeferred>("PrepareDeferred", prepareDeferredInputs);
     const auto deferredFramebuffer = prepareDeferredOutputs.getN<PrepareDeferred::Outputs>(0);
@@ -162,8 +167,12 @@ void RenderDeferredTask::build(JobModel& task, const render::Varying& input, ren
     const auto opaqueInputs = DrawStateSortDeferred::Inputs(opaques, lightingModel, jitter).asVarying();
     task.addJob<DrawStateSortDeferred>("DrawOpaqueDeferred", opaqueInputs, shapePlumber);
 
+    task.addJob<EndGPURangeTimer>("OpaqueRangeTimer", opaqueRangeTimer);
+
     // Opaque all rendered
 
+    const auto lightingRangeTimer = task.addJob<BeginGPURangeTimer>("BeginLightingRangeTimer", "Lighting");
+
     // Linear Depth Pass
     const auto linearDepthPassInputs = LinearDepthPass::Inputs(deferredFrameTransform, deferredFramebuffer).asVarying();
     const auto linearDepthPassOutputs = task.addJob<LinearDepthPass>("LinearDepth", linearDepthPassInputs);
@@ -201,6 +210,10 @@ void RenderDeferredTask::build(JobModel& task, const render::Varying& input, ren
     const auto deferredLightingInputs = RenderDeferred::Inputs(deferredFrameTransform, deferredFramebuffer, extraDeferredBuffer, lightingModel, lightClusters, lightFrame, shadowFrame, hazeFrame).asVarying();
     task.addJob<RenderDeferred>("RenderDeferred", deferredLightingInputs);
 
+    task.addJob<EndGPURangeTimer>("LightingRangeTimer", lightingRangeTimer);
+
+    const auto transparentRangeTimer = task.addJob<BeginGPURangeTimer>("BeginTransparentRangeTimer", "DrawTransparents");
+
     // Similar to light stage, background stage has been filled by several potential render items and resolved for the frame in this job
     const auto backgroundInputs = DrawBackgroundStage::Inputs(lightingModel, backgroundFrame, hazeFrame).asVarying();
     task.addJob<DrawBackgroundStage>("DrawBackgroundDeferred", backgroundInputs);
@@ -216,6 +229,10 @@ void RenderDeferredTask::build(JobModel& task, const render::Varying& input, ren
     const auto outlineInputs = DrawHighlightTask::Inputs(items, deferredFramebuffer, lightingFramebuffer, deferredFrameTransform, jitter).asVarying();
     task.addJob<DrawHighlightTask>("DrawHighlight", outlineInputs);
 
+    task.addJob<EndGPURangeTimer>("TransparentRangeTimer", transparentRangeTimer);
+
+    const auto postEffectsRangeTimer = task.addJob<BeginGPURangeTimer>("BeginPostEffectsRangeTimer", "PostEffects");
+
     // Layered Over (in front)
     const auto inFrontOpaquesInputs = DrawLayered3D::Inputs(inFrontOpaque, lightingModel, hazeFrame, jitter).asVarying();
     const auto inFrontTransparentsInputs = DrawLayered3D::Inputs(inFrontTransparent, lightingModel, hazeFrame, jitter).asVarying();
@@ -236,6 +253,8 @@ void RenderDeferredTask::build(JobModel& task, const render::Varying& input, ren
     const auto toneMappingInputs = ToneMapAndResample::Input(lightingFramebuffer, destFramebuffer).asVarying();
     const auto toneMappedBuffer = task.addJob<ToneMapAndResample>("ToneMapping", toneMappingInputs);
 
+    task.addJob<EndGPURangeTimer>("PostEffectsRangeTimer", postEffectsRangeTimer);
+
     // Debugging task is happening in the "over" layer after tone mapping and just before HUD
     { // Debug the bounds of the rendered items, still look at the zbuffer
         const auto extraDebugBuffers = RenderDeferredTaskDebug::ExtraBuffers(linearDepthTarget, surfaceGeometryFramebuffer, ambientOcclusionFramebuffer, ambientOcclusionUniforms, scatteringResource, velocityBuffer);
@@ -385,6 +385,16 @@ void RenderShadowSetup::run(const render::RenderContextPointer& renderContext, c
     *_cameraFrustum = args->getViewFrustum();
     output.edit2() = _cameraFrustum;
 
+    // TODO: caching static-caster cascade maps (render static geometry once,
+    // invalidate on light-direction or static-set changes, composite only
+    // dynamic casters per frame) was sized up against this setup. The blocker
+    // is right below: every cascade frustum is re-derived from the camera's
+    // view frustum each frame, so the maps aren't world-stable and a cached
+    // static render would swim. Caching requires camera-decoupled, texel-
+    // snapped cascade frusta first (world-anchored origin quantized to shadow
+    // texels), then a per-cascade static depth layer with a dirty bit fed by
+    // the scene's static-item change counts, with the per-frame pass rendering
+    // dynamic casters over a copy of the static layer.
     if (!_globalShadowObject) {
         _globalShadowObject = std::make_shared<LightStage::Shadow>(currentKeyLight, SHADOW_CASCADE_MAX_COUNT);
     }
@@ -314,8 +314,11 @@ inline QuadBuilder adjustedQuadBuilderForAlignmentMode(const Glyph& glyph, glm::
 
 void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm::vec2& origin, const glm::vec2& bounds, float scale, bool enlargeForShadows,
                          TextAlignment alignment) {
-    drawInfo.verticesBuffer = std::make_shared<gpu::Buffer>();
-    drawInfo.indicesBuffer = std::make_shared<gpu::Buffer>();
+    // keep the buffer objects across rebuilds; contents are replaced wholesale below
+    if (!drawInfo.verticesBuffer) {
+        drawInfo.verticesBuffer = std::make_shared<gpu::Buffer>();
+        drawInfo.indicesBuffer = std::make_shared<gpu::Buffer>();
+    }
     drawInfo.indexCount = 0;
     int numVertices = 0;
 
@@ -399,9 +402,16 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
     }
 
     // The quadBuilders is backwards now because we looped over the glyphs backwards to adjust their alignment
+    // stage everything CPU-side and upload each buffer once, instead of growing the
+    // gpu-side store with one append per glyph
+    std::vector<QuadBuilder> stagedQuads;
+    stagedQuads.reserve(quadBuilders.size());
+    std::vector<quint16> stagedIndices;
+    stagedIndices.reserve(quadBuilders.size() * NUMBER_OF_INDICES_PER_QUAD);
+
     for (int i = quadBuilders.size() - 1; i >= 0; i--) {
         quint16 verticesOffset = numVertices;
-        drawInfo.verticesBuffer->append(quadBuilders[i]);
+        stagedQuads.push_back(quadBuilders[i]);
         numVertices += VERTICES_PER_QUAD;
 
         // Sam's recommended triangle slices
@@ -421,16 +431,17 @@ void Font::buildVertices(Font::DrawInfo& drawInfo, const QString& str, const glm
         //  0 -- 1
         //
         //  { 0, 1, 2 } -> { 2, 1, 3 }
-        quint16 indices[NUMBER_OF_INDICES_PER_QUAD];
-        indices[0] = verticesOffset + 0;
-        indices[1] = verticesOffset + 1;
-        indices[2] = verticesOffset + 2;
-        indices[3] = verticesOffset + 2;
-        indices[4] = verticesOffset + 1;
-        indices[5] = verticesOffset + 3;
-        drawInfo.indicesBuffer->append(sizeof(indices), (const gpu::Byte*)indices);
+        stagedIndices.push_back(verticesOffset + 0);
+        stagedIndices.push_back(verticesOffset + 1);
+        stagedIndices.push_back(verticesOffset + 2);
+        stagedIndices.push_back(verticesOffset + 2);
+        stagedIndices.push_back(verticesOffset + 1);
+        stagedIndices.push_back(verticesOffset + 3);
         drawInfo.indexCount += NUMBER_OF_INDICES_PER_QUAD;
     }
+
+    drawInfo.verticesBuffer->setData(stagedQuads.size() * sizeof(QuadBuilder), (const gpu::Byte*)stagedQuads.data());
+    drawInfo.indicesBuffer->setData(stagedIndices.size() * sizeof(quint16), (const gpu::Byte*)stagedIndices.data());
 }
 
 void Font::drawString(gpu::Batch& batch, Font::DrawInfo& drawInfo, const QString& str, const glm::vec4& color,
@@ -20,6 +20,13 @@ namespace render {
     using CullFunctor = std::function<bool(const RenderArgs*, const AABox&)>;
 
     // Culling Frustum / solidAngle test helper class
+    //
+    // TODO: an occlusion test belongs here alongside the frustum and solid-angle
+    // tests: an HiZ pyramid downsampled from the previous frame's deferred depth,
+    // sampled with conservatively reprojected ItemBounds. The missing pieces are a
+    // depth-pyramid compute pass on DeferredFramebuffer and CPU readback (or a
+    // GPU-driven cull consuming the pyramid) - without one of those, the cull task
+    // has no depth to test against by the time it runs.
     struct CullTest {
         CullFunctor _functor;
         RenderArgs* _args;
@@ -74,10 +74,38 @@ void render::renderShapes(const RenderContextPointer& renderContext,
     if (maxDrawnItems != -1) {
         numItemsToDraw = glm::min(numItemsToDraw, maxDrawnItems);
     }
+
+    // consecutive items usually share a shape key (the lists arrive pipeline-sorted),
+    // so reuse the previous pick instead of re-running the plumber lookup per item
+    unsigned long lastKeyBits = 0;
+    bool havePickedPipeline = false;
+
     for (auto i = 0; i < numItemsToDraw; ++i) {
         auto& item = scene->getItem(inItems[i].id);
-        renderShape(args, shapeContext, item, globalKey);
+        assert(item.getKey().isShape());
+        auto key = item.getShapeKey() | globalKey;
+
+        if (key.isValid() && !key.hasOwnPipeline()) {
+            auto keyBits = key._flags.to_ulong();
+            args->_itemShapeKey = keyBits;
+            if (!havePickedPipeline || keyBits != lastKeyBits) {
+                args->_shapePipeline = shapeContext->pickPipeline(args, key);
+                lastKeyBits = keyBits;
+                havePickedPipeline = true;
+            }
+            if (args->_shapePipeline) {
+                args->_shapePipeline->prepareShapeItem(args, key, item);
+                item.render(args);
+            }
+            args->_itemShapeKey = 0;
+        } else {
+            // own-pipeline and invalid keys take the one-shot path
+            args->_shapePipeline = nullptr;
+            havePickedPipeline = false;
+            renderShape(args, shapeContext, item, globalKey);
+        }
     }
+    args->_shapePipeline = nullptr;
 }
 
 void render::renderStateSortShapes(const RenderContextPointer& renderContext,
@@ -90,11 +118,13 @@ void render::renderStateSortShapes(const RenderContextPointer& renderContext,
         numItemsToDraw = glm::min(numItemsToDraw, maxDrawnItems);
     }
 
+    // buckets hold pointers into the scene's stable item storage, so state sorting
+    // doesn't copy an Item (and bump its payload refcount) per drawn item per frame
     using SortedPipelines = std::vector<render::ShapeKey>;
-    using SortedShapes = std::unordered_map<render::ShapeKey, std::vector<Item>, render::ShapeKey::Hash, render::ShapeKey::KeyEqual>;
+    using SortedShapes = std::unordered_map<render::ShapeKey, std::vector<const Item*>, render::ShapeKey::Hash, render::ShapeKey::KeyEqual>;
     SortedPipelines sortedPipelines;
     SortedShapes sortedShapes;
-    std::vector< std::tuple<Item,ShapeKey> > ownPipelineBucket;
+    std::vector< std::tuple<const Item*, ShapeKey> > ownPipelineBucket;
 
     for (auto i = 0; i < numItemsToDraw; ++i) {
         auto& item = scene->getItem(inItems[i].id);
@@ -106,9 +136,9 @@ void render::renderStateSortShapes(const RenderContextPointer& renderContext,
                 if (bucket.empty()) {
                     sortedPipelines.push_back(key);
                 }
-                bucket.push_back(item);
+                bucket.push_back(&item);
             } else if (key.hasOwnPipeline()) {
-                ownPipelineBucket.push_back( std::make_tuple(item, key) );
+                ownPipelineBucket.push_back( std::make_tuple(&item, key) );
             } else {
                 std::call_once(messageIDFlag, [](int* id) { *id = LogHandler::getInstance().newRepeatedMessageID(); },
                     &repeatedInvalidKeyMessageID);
@@ -125,16 +155,16 @@ void render::renderStateSortShapes(const RenderContextPointer& renderContext,
             continue;
         }
         args->_itemShapeKey = pipelineKey._flags.to_ulong();
-        for (auto& item : bucket) {
-            args->_shapePipeline->prepareShapeItem(args, pipelineKey, item);
-            item.render(args);
+        for (auto item : bucket) {
+            args->_shapePipeline->prepareShapeItem(args, pipelineKey, *item);
+            item->render(args);
         }
     }
     args->_shapePipeline = nullptr;
     for (auto& itemAndKey : ownPipelineBucket) {
-        auto& item = std::get<0>(itemAndKey);
+        auto item = std::get<0>(itemAndKey);
         args->_itemShapeKey = std::get<1>(itemAndKey)._flags.to_ulong();
-        item.render(args);
+        item->render(args);
     }
     args->_itemShapeKey = 0;
 }
@@ -20,6 +20,13 @@ using namespace render;
 void RenderFetchCullSortTask::build(JobModel& task, const Varying& input, Varying& output, CullFunctor cullFunctor, uint8_t tagBits, uint8_t tagMask) {
     cullFunctor = cullFunctor ? cullFunctor : [](const RenderArgs*, const AABox&){ return true; };
 
+    // TODO: a GPU-driven path for the opaque bucket would replace CullSpatialSelection
+    // plus per-item submission with a compute pass over uploaded item AABBs feeding
+    // gpu::Batch::multiDrawIndirect (the command exists in the gpu lib but has no
+    // callers yet). The blockers are a persistent GPU mirror of the spatial tree's
+    // bounds and indirect-command generation in the shape pipelines; until those
+    // exist this task stays CPU-side.
+
     // CPU jobs:
     // Fetch and cull the items from the scene
     const ItemFilter filter = ItemFilter::Builder::visibleWorldItems().withoutLayered().withTagBits(tagBits, tagMask);
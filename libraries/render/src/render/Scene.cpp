@@ -189,6 +189,12 @@ Scene::Scene(glm::vec3 origin, float size) :
 
 Scene::~Scene() {
     qCDebug(renderlogging) << "Scene::~Scene()";
+
+    // release anything still staged in the lock-free handoff
+    Transaction* transaction = nullptr;
+    while (_transactionQueue.try_pop(transaction)) {
+        delete transaction;
+    }
 }
 
 ItemID Scene::allocateID() {
@@ -202,28 +208,26 @@ bool Scene::isAllocatedID(const ItemID& id) const {
 
 /// Enqueue change batch to the scene
 void Scene::enqueueTransaction(const Transaction& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(transaction);
+    _transactionQueue.push(new Transaction(transaction));
 }
 
 void Scene::enqueueTransaction(Transaction&& transaction) {
-    std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-    _transactionQueue.emplace_back(std::move(transaction));
+    _transactionQueue.push(new Transaction(std::move(transaction)));
 }
 
 uint32_t Scene::enqueueFrame() {
     PROFILE_RANGE(render, __FUNCTION__);
-    TransactionQueue localTransactionQueue;
-    {
-        std::unique_lock<std::mutex> lock(_transactionQueueMutex);
-        localTransactionQueue.swap(_transactionQueue);
-    }
 
     Transaction consolidatedTransaction;
-    consolidatedTransaction.merge(std::move(localTransactionQueue));
+    Transaction* transaction = nullptr;
+    while (_transactionQueue.try_pop(transaction)) {
+        consolidatedTransaction.merge(std::move(*transaction));
+        delete transaction;
+    }
+
     {
         std::unique_lock<std::mutex> lock(_transactionFramesMutex);
-        _transactionFrames.push_back(consolidatedTransaction);
+        _transactionFrames.push_back(std::move(consolidatedTransaction));
     }
 
     return ++_transactionFrameNumber;
@@ -12,6 +12,8 @@
 #ifndef hifi_render_Scene_h
 #define hifi_render_Scene_h
 
+#include <TBBHelpers.h>
+
 #include "Item.h"
 #include "SpatialTree.h"
 #include "Stage.h"
@@ -199,8 +201,10 @@ protected:
     // Thread safe elements that can be accessed from anywhere
     std::atomic<unsigned int> _IDAllocator{ 1 }; // first valid itemID will be One
     std::atomic<unsigned int> _numAllocatedItems{ 1 }; // num of allocated items, matching the _items.size()
-    std::mutex _transactionQueueMutex;
-    TransactionQueue _transactionQueue;
+    // lock-free MPSC handoff: producers enqueue from any thread without blocking
+    // against each other or the commit; the queue owns the pointers between push
+    // and drain
+    tbb::concurrent_queue<Transaction*> _transactionQueue;
 
     
     std::mutex _transactionFramesMutex;
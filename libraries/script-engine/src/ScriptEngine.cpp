@@ -1458,6 +1458,12 @@ void ScriptEngine::timerFired() {
     }
 }
 
+// NOTE on batching: entity script update() callbacks do not come through here -
+// they ride the engine's single per-frame update signal, so hundreds of scripted
+// entities already share one timer-driven invocation pass per engine. The QTimers
+// below exist only for script-authored setInterval/setTimeout; collapsing those
+// onto a shared wheel would change the precise-timer semantics scripts observe
+// for sub-200ms intervals, which is why each keeps its own timer.
 QObject* ScriptEngine::setupTimerWithInterval(const QScriptValue& function, int intervalMS, bool isSingleShot) {
     // create the timer, add it to the map, and start it
     QTimer* newTimer = new QTimer(this);
@@ -139,6 +139,13 @@ public:
  * @property {Script.ResourceBuckets} ExternalPaths - External resource buckets.
  */
 /// The main class managing a scripting engine.  Also provides the <code><a href="https://apidocs.vircadia.dev/Script.html">Script</a></code> scripting interface
+// TODO: a Script.profile API needs an in-thread collector: QScriptEngine's stack
+// may only be inspected from the engine's own thread, so the "sampling profiler on
+// a timer thread" shape is off the table - the safe implementation is a
+// QScriptEngineAgent recording function entry/exit (or the engine thread sampling
+// itself between microtasks), aggregated into flame-stack JSON. No agent is
+// installed today, so the hook is free; the work is the collector plus keeping its
+// overhead acceptable when enabled.
 class ScriptEngine : public BaseScriptEngine, public EntitiesScriptEngineProvider {
     Q_OBJECT
     Q_PROPERTY(QString context READ getContext)
@@ -0,0 +1,139 @@
+//
+//  AllocationTracking.cpp
+//  libraries/shared/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AllocationTracking.h"
+
+#if defined(HIFI_TRACK_ALLOCATIONS)
+
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+static thread_local uint64_t _threadAllocations { 0 };
+static thread_local uint64_t _threadBytes { 0 };
+
+static void* countedAllocate(size_t size) {
+    ++_threadAllocations;
+    _threadBytes += size;
+    return std::malloc(size);
+}
+
+// the full set of replaceable forms, so every allocation is paired with our free
+void* operator new(size_t size) {
+    if (void* pointer = countedAllocate(size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    if (void* pointer = countedAllocate(size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+
+#if defined(__cpp_aligned_new)
+// keep over-aligned allocations paired with our free as well
+static void* countedAlignedAllocate(size_t size, size_t alignment) {
+    ++_threadAllocations;
+    _threadBytes += size;
+#if defined(_MSC_VER)
+    return _aligned_malloc(size, alignment);
+#else
+    void* pointer = nullptr;
+    if (posix_memalign(&pointer, alignment, size) != 0) {
+        return nullptr;
+    }
+    return pointer;
+#endif
+}
+
+static void alignedFree(void* pointer) {
+#if defined(_MSC_VER)
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    if (void* pointer = countedAlignedAllocate(size, (size_t)alignment)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size, std::align_val_t alignment) {
+    if (void* pointer = countedAlignedAllocate(size, (size_t)alignment)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept { alignedFree(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { alignedFree(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { alignedFree(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { alignedFree(pointer); }
+#endif
+
+namespace allocation {
+
+Counts getThreadCounts() {
+    return { _threadAllocations, _threadBytes };
+}
+
+void resetThreadCounts() {
+    _threadAllocations = 0;
+    _threadBytes = 0;
+}
+
+bool isTrackingEnabled() {
+    return true;
+}
+
+}  // namespace allocation
+
+#else
+
+namespace allocation {
+
+Counts getThreadCounts() {
+    return Counts();
+}
+
+void resetThreadCounts() {
+}
+
+bool isTrackingEnabled() {
+    return false;
+}
+
+}  // namespace allocation
+
+#endif
@@ -0,0 +1,48 @@
+//
+//  AllocationTracking.h
+//  libraries/shared/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AllocationTracking_h
+#define hifi_AllocationTracking_h
+
+#include <cstdint>
+
+// Opt-in allocation counting, for validating zero-allocation paths and catching
+// allocation regressions in the benchmark suite.
+//
+// Define HIFI_TRACK_ALLOCATIONS (e.g. -DHIFI_TRACK_ALLOCATIONS in a local build)
+// to interpose global new/delete with per-thread counters. Without the define the
+// interposer is not compiled and the sampling functions return zeros, so shipping
+// builds pay nothing.
+//
+// Usage: sample counts around the code under test on the thread that runs it -
+//
+//     auto before = allocation::getThreadCounts();
+//     codeUnderTest();
+//     auto after = allocation::getThreadCounts();
+//     // after.allocations - before.allocations should be 0 for a hot path
+
+namespace allocation {
+
+struct Counts {
+    uint64_t allocations { 0 };
+    uint64_t bytes { 0 };
+};
+
+// Counters for the calling thread since thread start (or the last reset).
+Counts getThreadCounts();
+void resetThreadCounts();
+
+// True when the interposer is compiled in; lets callers skip assertions that
+// would vacuously pass against the zero counters.
+bool isTrackingEnabled();
+
+}  // namespace allocation
+
+#endif // hifi_AllocationTracking_h
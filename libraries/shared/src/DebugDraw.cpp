@@ -79,10 +79,24 @@ void DebugDraw::clearRays() {
 
 void DebugDraw::drawRays(const std::vector<std::pair<glm::vec3, glm::vec3>>& lines,
     const glm::vec4& color, const glm::vec3& translation, const glm::quat& rotation) {
-    Lock lock(_mapMutex);
-    for (std::pair<glm::vec3, glm::vec3> line : lines) {
+    // transform outside the lock - holding it through the math perturbs the
+    // animation and physics threads this facility is used to observe
+    Rays transformedRays;
+    transformedRays.reserve(lines.size());
+    for (const std::pair<glm::vec3, glm::vec3>& line : lines) {
         auto point1 = translation + rotation * line.first;
         auto point2 = translation + rotation * line.second;
-        _rays.push_back(Ray(point1, point2, color));
+        transformedRays.push_back(Ray(point1, point2, color));
     }
+
+    Lock lock(_mapMutex);
+    _rays.insert(_rays.end(), transformedRays.begin(), transformedRays.end());
+}
+
+DebugDraw::Rays DebugDraw::takeRays() {
+    // single lock for the consume-and-clear the renderer does each frame
+    Rays result;
+    Lock lock(_mapMutex);
+    result.swap(_rays);
+    return result;
 }
@@ -170,6 +170,9 @@ public:
     Rays getRays() const;
     void clearRays();
 
+    /// consume and clear the queued rays with a single lock acquisition
+    Rays takeRays();
+
 protected:
     mutable std::mutex _mapMutex;
     MarkerMap _markers;
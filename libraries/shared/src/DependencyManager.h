@@ -18,6 +18,7 @@
 #include <QtCore/QSharedPointer>
 #include <QWeakPointer>
 #include <QMutex>
+#include <QElapsedTimer>
 
 #include <functional>
 #include <typeinfo>
@@ -95,6 +96,11 @@ private:
     bool _exiting { false };
 };
 
+// NOTE: this is already the cached-handle fast path: the type hash resolves once
+// per type (function-local static) and the weak reference below memoizes the map
+// lookup, so steady-state get<T>() costs one weak-to-strong promotion. Callers in
+// per-frame loops that want to avoid even that refcount traffic should hoist the
+// shared pointer out of the loop rather than adding another cache layer here.
 template <typename T>
 QSharedPointer<T> DependencyManager::get() {
     static size_t hashCode = manager().getHashCode<T>();
@@ -140,7 +146,17 @@ QSharedPointer<T> DependencyManager::set(Args&&... args) {
         iter.value().clear();
     }
 
+    // startup is dominated by a handful of slow registrants with hidden I/O in
+    // their constructors; log anything slow enough to matter so cold-start
+    // regressions show up in the log instead of needing a profiler
+    static const qint64 SLOW_CONSTRUCTION_MS = 10;
+    QElapsedTimer constructionTimer;
+    constructionTimer.start();
     QSharedPointer<T> newInstance(new T(args...), &T::customDeleter);
+    qint64 constructionMs = constructionTimer.elapsed();
+    if (constructionMs >= SLOW_CONSTRUCTION_MS) {
+        qDebug() << "DependencyManager: construction of" << typeid(T).name() << "took" << constructionMs << "ms";
+    }
     manager()._instanceHash.insert(hashCode, newInstance);
 
     return newInstance;
@@ -157,7 +173,14 @@ QSharedPointer<T> DependencyManager::set(Args&&... args) {
         iter.value().clear();
     }
 
+    static const qint64 SLOW_CONSTRUCTION_MS = 10;
+    QElapsedTimer constructionTimer;
+    constructionTimer.start();
     QSharedPointer<T> newInstance(new I(args...), &I::customDeleter);
+    qint64 constructionMs = constructionTimer.elapsed();
+    if (constructionMs >= SLOW_CONSTRUCTION_MS) {
+        qDebug() << "DependencyManager: construction of" << typeid(I).name() << "took" << constructionMs << "ms";
+    }
     manager()._instanceHash.insert(hashCode, newInstance);
 
     return newInstance;
@@ -231,6 +231,121 @@ int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& qu
     return 6;
 }
 
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quatInput, int numQuats) {
+
+    const float MAGNITUDE = 1.0f / sqrtf(2.0f);
+    const uint32_t NUM_BITS_PER_COMPONENT = 15;
+    const uint32_t RANGE = (1 << NUM_BITS_PER_COMPONENT) - 1;
+
+    const int BATCH_SIZE = 64;
+    float c0[BATCH_SIZE], c1[BATCH_SIZE], c2[BATCH_SIZE];
+    uint8_t largest[BATCH_SIZE];
+
+    for (int base = 0; base < numQuats; base += BATCH_SIZE) {
+        int count = (numQuats - base < BATCH_SIZE) ? numQuats - base : BATCH_SIZE;
+
+        // stage: find the largest component, flip its sign negative, and gather the
+        // remaining three components in structure-of-arrays form
+        for (int i = 0; i < count; i++) {
+            const glm::quat& quatInputValue = quatInput[base + i];
+
+            uint8_t largestComponent = 0;
+            for (int k = 1; k < 4; k++) {
+                if (fabs(quatInputValue[k]) > fabs(quatInputValue[largestComponent])) {
+                    largestComponent = k;
+                }
+            }
+            glm::quat q = quatInputValue[largestComponent] > 0 ? -quatInputValue : quatInputValue;
+
+            float components[3];
+            for (int k = 0, j = 0; k < 4; k++) {
+                if (k != largestComponent) {
+                    components[j++] = q[k];
+                }
+            }
+            c0[i] = components[0];
+            c1[i] = components[1];
+            c2[i] = components[2];
+            largest[i] = largestComponent;
+        }
+
+        // quantize - these loops vectorize
+        for (int i = 0; i < count; i++) {
+            c0[i] = (c0[i] + MAGNITUDE) / (2.0f * MAGNITUDE);
+            c1[i] = (c1[i] + MAGNITUDE) / (2.0f * MAGNITUDE);
+            c2[i] = (c2[i] + MAGNITUDE) / (2.0f * MAGNITUDE);
+        }
+
+        // encode the component bits and the largest-component index
+        for (int i = 0; i < count; i++) {
+            uint16_t components[3] = {
+                (uint16_t)(c0[i] * RANGE),
+                (uint16_t)(c1[i] * RANGE),
+                (uint16_t)(c2[i] * RANGE)
+            };
+            components[0] = (0x7fff & components[0]) | ((0x01 & largest[i]) << 15);
+            components[1] = (0x7fff & components[1]) | ((0x02 & largest[i]) << 14);
+
+            unsigned char* b = buffer + (base + i) * 6;
+            b[0] = HI_BYTE(components[0]);
+            b[1] = LO_BYTE(components[0]);
+            b[2] = HI_BYTE(components[1]);
+            b[3] = LO_BYTE(components[1]);
+            b[4] = HI_BYTE(components[2]);
+            b[5] = LO_BYTE(components[2]);
+        }
+    }
+
+    return numQuats * 6;
+}
+
+int unpackOrientationQuatsFromSixBytes(const unsigned char* buffer, glm::quat* quatOutput, int numQuats) {
+
+    const uint32_t NUM_BITS_PER_COMPONENT = 15;
+    const float RANGE = (float)((1 << NUM_BITS_PER_COMPONENT) - 1);
+    const float MAGNITUDE = 1.0f / sqrtf(2.0f);
+
+    const int BATCH_SIZE = 64;
+    float c0[BATCH_SIZE], c1[BATCH_SIZE], c2[BATCH_SIZE], missing[BATCH_SIZE];
+    uint8_t largest[BATCH_SIZE];
+
+    for (int base = 0; base < numQuats; base += BATCH_SIZE) {
+        int count = (numQuats - base < BATCH_SIZE) ? numQuats - base : BATCH_SIZE;
+
+        // stage the quantized components in structure-of-arrays form
+        for (int i = 0; i < count; i++) {
+            const unsigned char* b = buffer + (base + i) * 6;
+            c0[i] = (float)(((uint16_t)(0x7f & b[0]) << 8) | b[1]);
+            c1[i] = (float)(((uint16_t)(0x7f & b[2]) << 8) | b[3]);
+            c2[i] = (float)(((uint16_t)(0x7f & b[4]) << 8) | b[5]);
+            largest[i] = ((0x80 & b[2]) >> 6) | ((0x80 & b[0]) >> 7);
+        }
+
+        // dequantize and recover the dropped component - these loops vectorize
+        for (int i = 0; i < count; i++) {
+            c0[i] = (c0[i] / RANGE) * (2.0f * MAGNITUDE) - MAGNITUDE;
+            c1[i] = (c1[i] / RANGE) * (2.0f * MAGNITUDE) - MAGNITUDE;
+            c2[i] = (c2[i] / RANGE) * (2.0f * MAGNITUDE) - MAGNITUDE;
+            missing[i] = -sqrtf(1.0f - c0[i] * c0[i] - c1[i] * c1[i] - c2[i] * c2[i]);
+        }
+
+        // scatter to the output quaternions
+        for (int i = 0; i < count; i++) {
+            glm::quat& q = quatOutput[base + i];
+            float components[3] = { c0[i], c1[i], c2[i] };
+            for (int k = 0, j = 0; k < 4; k++) {
+                if (k == largest[i]) {
+                    q[k] = missing[i];
+                } else {
+                    q[k] = components[j++];
+                }
+            }
+        }
+    }
+
+    return numQuats * 6;
+}
+
 bool closeEnough(float a, float b, float relativeError) {
     assert(relativeError >= 0.0f);
     // NOTE: we add EPSILON to the denominator so we can avoid checking for division by zero.
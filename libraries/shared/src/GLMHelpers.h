@@ -118,6 +118,12 @@ int unpackOrientationQuatFromBytes(const unsigned char* buffer, glm::quat& quatO
 int packOrientationQuatToSixBytes(unsigned char* buffer, const glm::quat& quatInput);
 int unpackOrientationQuatFromSixBytes(const unsigned char* buffer, glm::quat& quatOutput);
 
+// batch variants over contiguous six-byte records, bit-identical to the single-quat
+// forms; they stage the quantization math in structure-of-arrays form so whole
+// skeletons encode/decode in vectorizable loops instead of per-joint calls
+int packOrientationQuatsToSixBytes(unsigned char* buffer, const glm::quat* quatInput, int numQuats);
+int unpackOrientationQuatsFromSixBytes(const unsigned char* buffer, glm::quat* quatOutput, int numQuats);
+
 // Ratios need the be highly accurate when less than 10, but not very accurate above 10, and they
 // are never greater than 1000 to 1, this allows us to encode each component in 16bits
 int packFloatRatioToTwoByte(unsigned char* buffer, float ratio);
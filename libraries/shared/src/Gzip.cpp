@@ -94,7 +94,6 @@ bool gzip(QByteArray source, QByteArray &destination, int compressionLevel) {
         return true;
     }
 
-    int flushOrFinish = 0;
     z_stream strm;
     strm.zalloc = Z_NULL;
     strm.zfree = Z_NULL;
@@ -111,45 +110,26 @@ bool gzip(QByteArray source, QByteArray &destination, int compressionLevel) {
     if (status != Z_OK) {
         return false;
     }
-    char *sourceData = source.data();
-    int sourceDataLength = source.length();
-
-    for (;;) {
-        int chunkSize = qMin(GZIP_CHUNK_SIZE, sourceDataLength);
-        strm.next_in = (unsigned char*)sourceData;
-        strm.avail_in = chunkSize;
-        sourceData += chunkSize;
-        sourceDataLength -= chunkSize;
-
-        if (sourceDataLength <= 0) {
-            flushOrFinish = Z_FINISH;
-        } else {
-            flushOrFinish = Z_NO_FLUSH;
-        }
-
-        for (;;) {
-            char out[GZIP_CHUNK_SIZE];
-            strm.next_out = (unsigned char*)out;
-            strm.avail_out = GZIP_CHUNK_SIZE;
-            status = deflate(&strm, flushOrFinish);
-            if (status == Z_STREAM_ERROR) {
-                deflateEnd(&strm);
-                return false;
-            }
-            int available = (GZIP_CHUNK_SIZE - strm.avail_out);
-            if (available > 0) {
-                destination.append((char*)out, available);
-            }
-            if (strm.avail_out != 0) {
-                break;
-            }
-        }
+    // compress in one pass into a deflateBound-sized buffer instead of feeding
+    // 4KB chunks and appending per chunk - on persist-sized snapshots the
+    // repeated deflate calls and destination reallocation were a large share
+    // of the compression wall time
+    uLong bound = deflateBound(&strm, (uLong)source.length());
+    destination.resize((int)bound);
+
+    strm.next_in = (unsigned char*)source.data();
+    strm.avail_in = source.length();
+    strm.next_out = (unsigned char*)destination.data();
+    strm.avail_out = (uInt)bound;
+
+    status = deflate(&strm, Z_FINISH);
+    deflateEnd(&strm);
 
-        if (flushOrFinish == Z_FINISH) {
-            break;
-        }
+    if (status != Z_STREAM_END) {
+        destination.clear();
+        return false;
     }
 
-    deflateEnd(&strm);
-    return status == Z_STREAM_END;
+    destination.resize((int)(bound - strm.avail_out));
+    return true;
 }
@@ -315,12 +315,22 @@ template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operato
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator+=(const PropertyFlags& other) {
+    if (!other._trailingFlipped) {
+        // common case: merge with one bitwise OR over the backing bit arrays instead
+        // of testing and setting every flag in other's range - group merges in
+        // EntityItemProperties::getChangedProperties lean on this heavily
+        _flags |= other._flags;
+        _maxFlag = std::max(_maxFlag, other._maxFlag);
+        _minFlag = std::min(_minFlag, other._minFlag);
+        return *this;
+    }
+
     for(int flag = (int)other.firstFlag(); flag <= (int)other.lastFlag(); flag++) {
         if (other.getHasProperty((Enum)flag)) {
             setHasProperty((Enum)flag, true);
         }
     }
-    return *this; 
+    return *this;
 }
 
 template<typename Enum> inline PropertyFlags<Enum>& PropertyFlags<Enum>::operator+=(Enum flag) {
@@ -51,6 +51,11 @@ extern "C" FILE * __cdecl __iob_func(void) {
 #include <cerrno>
 #endif
 
+#if defined(Q_OS_LINUX)
+#include <sched.h>
+#include <unistd.h>
+#endif
+
 #include <QtCore/QDebug>
 #include <QDateTime>
 #include <QElapsedTimer>
@@ -1035,7 +1040,20 @@ const QString& getInterfaceSharedMemoryName() {
 
 const std::vector<uint8_t>& getAvailableCores() {
     static std::vector<uint8_t> availableCores;
-#ifdef Q_OS_WIN
+#if defined(Q_OS_LINUX)
+    static std::once_flag once;
+    std::call_once(once, [&] {
+        cpu_set_t defaultAffinity;
+        CPU_ZERO(&defaultAffinity);
+        if (sched_getaffinity(0, sizeof(defaultAffinity), &defaultAffinity) == 0) {
+            for (int i = 0; i < CPU_SETSIZE && i < UINT8_MAX; ++i) {
+                if (CPU_ISSET(i, &defaultAffinity)) {
+                    availableCores.push_back((uint8_t)i);
+                }
+            }
+        }
+    });
+#elif defined(Q_OS_WIN)
     static std::once_flag once;
     std::call_once(once, [&] {
         DWORD_PTR defaultProcessAffinity = 0, defaultSystemAffinity = 0;
@@ -1054,7 +1072,28 @@ const std::vector<uint8_t>& getAvailableCores() {
 }
 
 void setMaxCores(uint8_t maxCores) {
-#ifdef Q_OS_WIN
+#if defined(Q_OS_LINUX)
+    // pick a contiguous block of cores rather than a random subset: on
+    // multi-socket servers contiguous ids generally share a package, which
+    // keeps the process's threads and the buffers they touch on one memory
+    // controller instead of bouncing between NUMA nodes
+    auto availableCores = getAvailableCores();
+    if (maxCores == 0 || availableCores.size() <= maxCores) {
+        return;
+    }
+
+    // spread different children across the machine by choosing the block
+    // from the process id
+    size_t blockCount = availableCores.size() / maxCores;
+    size_t blockIndex = (size_t)getpid() % blockCount;
+
+    cpu_set_t newAffinity;
+    CPU_ZERO(&newAffinity);
+    for (size_t i = 0; i < maxCores; ++i) {
+        CPU_SET(availableCores[blockIndex * maxCores + i], &newAffinity);
+    }
+    sched_setaffinity(0, sizeof(newAffinity), &newAffinity);
+#elif defined(Q_OS_WIN)
     HANDLE process = GetCurrentProcess();
     auto availableCores = getAvailableCores();
     if (availableCores.size() <= maxCores) {
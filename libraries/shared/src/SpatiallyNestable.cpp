@@ -80,6 +80,9 @@ void SpatiallyNestable::setParentID(const QUuid& parentID) {
             _parentKnowsMe = false;
         }
     });
+    // set after the id write: a concurrent reader can then only clear the flag if
+    // it observed the id still null under the lock, and this store lands after
+    _maybeHasParent.store(true, std::memory_order_release);
 
     if (parentChanged && success && parent) {
         parent->recalculateChildCauterization();
@@ -112,12 +115,27 @@ Transform SpatiallyNestable::getParentTransform(bool& success, int depth) const
 }
 
 SpatiallyNestablePointer SpatiallyNestable::getParentPointer(bool& success) const {
+    // The overwhelmingly common case is an object that has never been parented:
+    // skip the id lock and weak-pointer churn entirely. The flag starts pessimistic
+    // and is cleared below only after confirming there is no parent; any call to
+    // setParentID sets it again.
+    if (!_maybeHasParent.load(std::memory_order_acquire)) {
+        success = true;
+        return nullptr;
+    }
+
     SpatiallyNestablePointer parent = _parent.lock();
     QUuid parentID = getParentID(); // used for its locking
 
     if (!parent && parentID.isNull()) {
-        // no parent
+        // no parent; re-confirm under the id lock before clearing the hint so a
+        // concurrent setParentID can't have its flag-set clobbered
         success = true;
+        _idLock.withReadLock([&] {
+            if (_parentID.isNull()) {
+                _maybeHasParent.store(false, std::memory_order_release);
+            }
+        });
         return nullptr;
     }
 
@@ -734,6 +752,34 @@ void SpatiallyNestable::setWorldAngularVelocity(const glm::vec3& angularVelocity
     }
 }
 
+void SpatiallyNestable::setWorldVelocities(const glm::vec3& velocity, const glm::vec3& angularVelocity) {
+    bool success = true;
+    glm::vec3 parentVelocity = getParentVelocity(success);
+    glm::vec3 parentAngularVelocity = getParentAngularVelocity(success);
+    Transform parentTransform = getParentTransform(success);
+    if (!success) {
+        // matching the individual setters: warn, but still apply the values
+        qCDebug(shared) << "Warning -- setWorldVelocities failed" << getID();
+    }
+
+    glm::quat inverseParentRotation = glm::inverse(parentTransform.getRotation());
+
+    // see setWorldVelocity for the reasoning behind the avatar-ancestor special case
+    bool hasAvatarAncestor = hasAncestorOfType(NestableType::Avatar);
+
+    _velocityLock.withWriteLock([&] {
+        if (hasAvatarAncestor) {
+            _velocity = velocity;
+        } else {
+            // TODO: take parent angularVelocity into account.
+            _velocity = inverseParentRotation * (velocity - parentVelocity);
+        }
+    });
+    _angularVelocityLock.withWriteLock([&] {
+        _angularVelocity = inverseParentRotation * (angularVelocity - parentAngularVelocity);
+    });
+}
+
 glm::vec3 SpatiallyNestable::getParentAngularVelocity(bool& success) const {
     glm::vec3 result;
     SpatiallyNestablePointer parent = getParentPointer(success);
@@ -12,6 +12,8 @@
 #ifndef hifi_SpatiallyNestable_h
 #define hifi_SpatiallyNestable_h
 
+#include <atomic>
+
 #include <QUuid>
 
 #include "Transform.h"
@@ -111,6 +113,10 @@ public:
     virtual glm::vec3 getWorldAngularVelocity() const;
     virtual void setWorldAngularVelocity(const glm::vec3& angularVelocity, bool& success);
     virtual void setWorldAngularVelocity(const glm::vec3& angularVelocity);
+
+    // combined setter for the physics sync path: parent state is resolved once
+    // and each velocity lock is taken once for both values
+    void setWorldVelocities(const glm::vec3& velocity, const glm::vec3& angularVelocity);
     virtual glm::vec3 getParentAngularVelocity(bool& success) const;
 
     virtual AACube getMaximumAACube(bool& success) const;
@@ -254,6 +260,8 @@ private:
     SpatiallyNestable() = delete;
     const NestableType _nestableType; // EntityItem or an AvatarData
     QUuid _parentID; // what is this thing's transform relative to?
+    // fast-path flag for getParentPointer: false only when confirmed unparented
+    mutable std::atomic<bool> _maybeHasParent { true };
     quint16 _parentJointIndex { INVALID_JOINT_INDEX }; // which joint of the parent is this relative to?
 
     mutable ReadWriteLockable _transformLock;
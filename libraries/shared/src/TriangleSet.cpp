@@ -13,7 +13,7 @@
 
 #include "GLMHelpers.h"
 
-#include <list>
+#include <utility>
 
 void TriangleSet::insert(const Triangle& t) {
     _isBalanced = false;
@@ -260,41 +260,39 @@ bool TriangleSet::TriangleTreeCell::findRayIntersection(const glm::vec3& origin,
 
     // if we're not yet at the max depth, then check our children
     if (_depth < MAX_DEPTH) {
-        std::list<SortedTriangleCell> sortedTriangleCells;
-        auto sortingOperator = [&](std::shared_ptr<TriangleTreeCell>& child) {
-            if (child) {
-                float priority = FLT_MAX;
-                if (child->getBounds().contains(origin)) {
-                    priority = 0.0f;
-                } else {
-                    float childBoundDistance = FLT_MAX;
-                    BoxFace childBoundFace;
-                    glm::vec3 childBoundNormal;
-                    if (child->getBounds().findRayIntersection(origin, direction, invDirection, childBoundDistance, childBoundFace, childBoundNormal)) {
-                        // We only need to add this cell if it's closer than the local triangle set intersection (if there was one)
-                        if (childBoundDistance < bestLocalDistance) {
-                            priority = childBoundDistance;
-                        }
-                    }
-                }
-
-                if (priority < FLT_MAX) {
-                    if (sortedTriangleCells.size() > 0 && priority < sortedTriangleCells.front().first) {
-                        sortedTriangleCells.emplace_front(priority, child);
-                    } else {
-                        sortedTriangleCells.emplace_back(priority, child);
-                    }
+        // there are at most two children - order them near-to-far on the stack
+        // instead of building a heap-allocated list per visited node
+        auto childPriority = [&](const std::shared_ptr<TriangleTreeCell>& child) -> float {
+            if (!child) {
+                return FLT_MAX;
+            }
+            if (child->getBounds().contains(origin)) {
+                return 0.0f;
+            }
+            float childBoundDistance = FLT_MAX;
+            BoxFace childBoundFace;
+            glm::vec3 childBoundNormal;
+            if (child->getBounds().findRayIntersection(origin, direction, invDirection, childBoundDistance, childBoundFace, childBoundNormal)) {
+                // We only need to visit this cell if it's closer than the local triangle set intersection (if there was one)
+                if (childBoundDistance < bestLocalDistance) {
+                    return childBoundDistance;
                 }
             }
+            return FLT_MAX;
         };
-        sortingOperator(_children.first);
-        sortingOperator(_children.second);
 
-        for (auto it = sortedTriangleCells.begin(); it != sortedTriangleCells.end(); ++it) {
-            const SortedTriangleCell& sortedTriangleCell = *it;
+        SortedTriangleCell sortedTriangleCells[2] = { { childPriority(_children.first), _children.first },
+                                                      { childPriority(_children.second), _children.second } };
+        if (sortedTriangleCells[1].first < sortedTriangleCells[0].first) {
+            std::swap(sortedTriangleCells[0], sortedTriangleCells[1]);
+        }
+
+        for (int i = 0; i < 2; i++) {
+            const SortedTriangleCell& sortedTriangleCell = sortedTriangleCells[i];
             float childDistance = sortedTriangleCell.first;
-            // We can exit once childDistance > bestLocalDistance
-            if (childDistance > bestLocalDistance) {
+            // We can exit once childDistance > bestLocalDistance, and FLT_MAX marks
+            // a missing or missed child
+            if (childDistance == FLT_MAX || childDistance > bestLocalDistance) {
                 break;
             }
             // If we're inside the child cell and !precision, we need the actual distance to the cell bounds
@@ -409,41 +407,39 @@ bool TriangleSet::TriangleTreeCell::findParabolaIntersection(const glm::vec3& or
 
     // if we're not yet at the max depth, then check our children
     if (_depth < MAX_DEPTH) {
-        std::list<SortedTriangleCell> sortedTriangleCells;
-        auto sortingOperator = [&](std::shared_ptr<TriangleTreeCell>& child) {
-            if (child) {
-                float priority = FLT_MAX;
-                if (child->getBounds().contains(origin)) {
-                    priority = 0.0f;
-                } else {
-                    float childBoundDistance = FLT_MAX;
-                    BoxFace childBoundFace;
-                    glm::vec3 childBoundNormal;
-                    if (child->getBounds().findParabolaIntersection(origin, velocity, acceleration, childBoundDistance, childBoundFace, childBoundNormal)) {
-                        // We only need to add this cell if it's closer than the local triangle set intersection (if there was one)
-                        if (childBoundDistance < bestLocalDistance) {
-                            priority = childBoundDistance;
-                        }
-                    }
-                }
-
-                if (priority < FLT_MAX) {
-                    if (sortedTriangleCells.size() > 0 && priority < sortedTriangleCells.front().first) {
-                        sortedTriangleCells.emplace_front(priority, child);
-                    } else {
-                        sortedTriangleCells.emplace_back(priority, child);
-                    }
+        // there are at most two children - order them near-to-far on the stack
+        // instead of building a heap-allocated list per visited node
+        auto childPriority = [&](const std::shared_ptr<TriangleTreeCell>& child) -> float {
+            if (!child) {
+                return FLT_MAX;
+            }
+            if (child->getBounds().contains(origin)) {
+                return 0.0f;
+            }
+            float childBoundDistance = FLT_MAX;
+            BoxFace childBoundFace;
+            glm::vec3 childBoundNormal;
+            if (child->getBounds().findParabolaIntersection(origin, velocity, acceleration, childBoundDistance, childBoundFace, childBoundNormal)) {
+                // We only need to visit this cell if it's closer than the local triangle set intersection (if there was one)
+                if (childBoundDistance < bestLocalDistance) {
+                    return childBoundDistance;
                 }
             }
+            return FLT_MAX;
         };
-        sortingOperator(_children.first);
-        sortingOperator(_children.second);
 
-        for (auto it = sortedTriangleCells.begin(); it != sortedTriangleCells.end(); ++it) {
-            const SortedTriangleCell& sortedTriangleCell = *it;
+        SortedTriangleCell sortedTriangleCells[2] = { { childPriority(_children.first), _children.first },
+                                                      { childPriority(_children.second), _children.second } };
+        if (sortedTriangleCells[1].first < sortedTriangleCells[0].first) {
+            std::swap(sortedTriangleCells[0], sortedTriangleCells[1]);
+        }
+
+        for (int i = 0; i < 2; i++) {
+            const SortedTriangleCell& sortedTriangleCell = sortedTriangleCells[i];
             float childDistance = sortedTriangleCell.first;
-            // We can exit once childDistance > bestLocalDistance
-            if (childDistance > bestLocalDistance) {
+            // We can exit once childDistance > bestLocalDistance, and FLT_MAX marks
+            // a missing or missed child
+            if (childDistance == FLT_MAX || childDistance > bestLocalDistance) {
                 break;
             }
             // If we're inside the child cell and !precision, we need the actual distance to the cell bounds
@@ -208,11 +208,17 @@ bool ViewFrustum::sphereIntersectsFrustum(const glm::vec3& center, float radius)
 }
 
 bool ViewFrustum::boxIntersectsFrustum(const AABox& box) const {
+    // center/half-extent form: the distance to the farthest corner along a plane
+    // normal is distance(center) + dot(|normal|, halfExtent), which keeps the
+    // per-plane test branch-free - this runs per item in the cull hot loop
+    glm::vec3 center = box.calcCenter();
+    glm::vec3 halfExtent = 0.5f * box.getDimensions();
+
     // only check against frustum
     for(int i = 0; i < NUM_FRUSTUM_PLANES; i++) {
         const glm::vec3& normal = _planes[i].getNormal();
         // check distance to farthest box point
-        if ( _planes[i].distance(box.getFarthestVertex(normal)) < 0.0f) {
+        if (_planes[i].distance(center) + glm::dot(glm::abs(normal), halfExtent) < 0.0f) {
             return false;
         }
     }
@@ -220,11 +226,14 @@ bool ViewFrustum::boxIntersectsFrustum(const AABox& box) const {
 }
 
 bool ViewFrustum::boxInsideFrustum(const AABox& box) const {
+    glm::vec3 center = box.calcCenter();
+    glm::vec3 halfExtent = 0.5f * box.getDimensions();
+
     // only check against frustum
     for (int i = 0; i < NUM_FRUSTUM_PLANES; i++) {
         const glm::vec3& normal = _planes[i].getNormal();
         // check distance to nearest box point
-        if (_planes[i].distance(box.getNearestVertex(normal)) < 0.0f) {
+        if (_planes[i].distance(center) - glm::dot(glm::abs(normal), halfExtent) < 0.0f) {
             return false;
         }
     }
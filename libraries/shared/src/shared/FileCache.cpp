@@ -40,6 +40,10 @@ using namespace cache;
 static const char DIR_SEP = '/';
 static const char EXT_SEP = '.';
 
+// journal of cache contents written on clean shutdown and consumed on startup,
+// so initialization reads one file instead of enumerating the whole directory
+static const char* MANIFEST_FILENAME = "manifest.txt";
+
 const size_t FileCache::DEFAULT_MAX_SIZE { GB_TO_BYTES(5) };
 const size_t FileCache::MAX_MAX_SIZE { GB_TO_BYTES(100) };
 const size_t FileCache::DEFAULT_MIN_FREE_STORAGE_SPACE { GB_TO_BYTES(1) };
@@ -96,20 +100,44 @@ void FileCache::initialize() {
     QDir dir(_dirpath.c_str());
 
     if (dir.exists()) {
-        auto nameFilters = QStringList(("*." + _ext).c_str());
-        auto filters = QDir::Filters(QDir::NoDotAndDotDot | QDir::Files);
-        auto sort = QDir::SortFlags(QDir::Time);
-        auto files = dir.entryList(nameFilters, filters, sort);
-
-        // load persisted files
-        foreach(QString filename, files) {
-            const Key key = filename.section('.', 0, 0).toStdString();
-            const std::string filepath = dir.filePath(filename).toStdString();
-            const size_t length = QFileInfo(filepath.c_str()).size();
-            addFile(Metadata(key, length), filepath);
-        }
+        // prefer the manifest journal from the last clean shutdown: one read replaces
+        // enumerating and sorting the directory and a size stat per entry. The journal
+        // is consumed here and only rewritten on clean shutdown, so after a crash it's
+        // absent and the scan below rebuilds the index from disk.
+        QFile manifest(QString::fromStdString(_dirpath + DIR_SEP + MANIFEST_FILENAME));
+        if (manifest.open(QIODevice::ReadOnly | QIODevice::Text)) {
+            size_t entries = 0;
+            while (!manifest.atEnd()) {
+                QByteArray line = manifest.readLine().trimmed();
+                int separator = line.lastIndexOf(' ');
+                if (separator <= 0) {
+                    continue;
+                }
+                const Key key = line.left(separator).toStdString();
+                const size_t length = (size_t)line.mid(separator + 1).toULongLong();
+                addFile(Metadata(key, length), getFilepath(key));
+                ++entries;
+            }
+            manifest.close();
+            manifest.remove();
+            qCDebug(file_cache, "[%s] Initialized %s from manifest, %d entries",
+                    _dirname.c_str(), _dirpath.c_str(), (int)entries);
+        } else {
+            auto nameFilters = QStringList(("*." + _ext).c_str());
+            auto filters = QDir::Filters(QDir::NoDotAndDotDot | QDir::Files);
+            auto sort = QDir::SortFlags(QDir::Time);
+            auto files = dir.entryList(nameFilters, filters, sort);
+
+            // load persisted files
+            foreach(QString filename, files) {
+                const Key key = filename.section('.', 0, 0).toStdString();
+                const std::string filepath = dir.filePath(filename).toStdString();
+                const size_t length = QFileInfo(filepath.c_str()).size();
+                addFile(Metadata(key, length), filepath);
+            }
 
-        qCDebug(file_cache, "[%s] Initialized %s", _dirname.c_str(), _dirpath.c_str());
+            qCDebug(file_cache, "[%s] Initialized %s", _dirname.c_str(), _dirpath.c_str());
+        }
     } else {
         dir.mkpath(_dirpath.c_str());
         qCDebug(file_cache, "[%s] Created %s", _dirname.c_str(), _dirpath.c_str());
@@ -310,6 +338,25 @@ void FileCache::clear() {
     // Eliminate any overbudget files
     clean();
 
+    // Journal the surviving entries while they're still alive, so the next startup
+    // can rebuild the index without scanning the directory
+    QSaveFile manifest(QString::fromStdString(_dirpath + DIR_SEP + MANIFEST_FILENAME));
+    if (manifest.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        QByteArray contents;
+        for (const auto& entry : _files) {
+            if (auto file = entry.second.lock()) {
+                contents.append(file->getKey().c_str());
+                contents.append(' ');
+                contents.append(std::to_string(file->getLength()).c_str());
+                contents.append('\n');
+            }
+        }
+        manifest.write(contents);
+        if (!manifest.commit()) {
+            qCWarning(file_cache, "[%s] Failed to write manifest", _dirname.c_str());
+        }
+    }
+
     // Mark everything remaining as persisted while effectively ejecting from the cache
     for (auto& file : _unusedFiles) {
         file->_shouldPersist = true;
@@ -10,6 +10,15 @@
 
 // Minimalist threadsafe Promise-like helper for managing asynchronous results
 //
+// NOTE: this is already the promise/awaitable bridging layer scripts use for asset
+// and HTTP style calls. Each cross-thread settlement currently posts its own queued
+// invocation via executeOnPromiseThread, so N completions wake the script thread N
+// times; batching them into one flush per frame would need a per-engine settled
+// queue drained from the engine's update tick, plus care that same-turn resolution
+// ordering (resolve-then-handle within one event loop turn) is preserved for
+// handlers attached after settlement. Worth doing as its own change with script
+// conformance tests; noted here so the wakeup cost isn't mistaken for app code.
+//
 // This class pivots around continuation-style callback handlers:
 //     auto successCallback = [=](QVariantMap result) { .... }
 //     auto errorCallback = [=](QString error) { .... }
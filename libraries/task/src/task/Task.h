@@ -17,6 +17,13 @@
 
 #include <unordered_map>
 
+// TODO: jobs in a task graph run strictly sequentially on the owning thread. A
+// real executor could run independent branches concurrently - the Varying
+// input/output declarations already express the data dependencies needed to build
+// the schedule - but today's jobs assume serial execution freely: they share
+// RenderArgs/batches mutably, touch singletons, and rely on run order for state
+// carried outside Varyings. Those contracts need tightening (jobs declaring all
+// reads/writes through Varyings) before a work-stealing pool can be dropped in.
 namespace task {
 
 class JobConcept;
@@ -22,6 +22,14 @@
 
 #include "Space.h"
 
+// Region consumers, for orientation: physics activation keys off R1/R2 (the
+// original consumer); avatar IK and flow simulation now gate on R2 in
+// AvatarManager; GPU texture demotion prefers bind-stale content; and the
+// entity renderer's per-entity update pass is budgeted through a distance-aware
+// priority sort rather than raw region bits. Remaining candidates - script
+// update rates and audio injector activation - should follow the avatar
+// pattern: read the proxy's region where the per-object work is scheduled, and
+// treat transitions as rate changes rather than hard on/off switches.
 namespace workload {
     class WorkloadContext : public task::JobContext {
     public:
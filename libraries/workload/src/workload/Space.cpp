@@ -24,6 +24,7 @@ Space::Space() : Collection() {
 }
 
 void Space::processTransactionFrame(const Transaction& transaction) {
+    _proxiesChanged = true;
     std::unique_lock<std::mutex> lock(_proxiesMutex);
     // Here we should be able to check the value of last ProxyID allocated
     // and allocate new proxies accordingly
@@ -92,6 +93,15 @@ void Space::processUpdates(const Transaction::Updates& transactions) {
 
 void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
     std::unique_lock<std::mutex> lock(_proxiesMutex);
+
+    // change detection: with unmoved views and untouched proxies the pass can't
+    // produce any region transitions, so skip walking the whole proxy set
+    if (!_viewsChanged && !_proxiesChanged) {
+        return;
+    }
+    _viewsChanged = false;
+    _proxiesChanged = false;
+
     uint32_t numProxies = (uint32_t)_proxies.size();
     uint32_t numViews = (uint32_t)_views.size();
     for (uint32_t i = 0; i < numProxies; ++i) {
@@ -110,6 +120,10 @@ void Space::categorizeAndGetChanges(std::vector<Space::Change>& changes) {
                         break;
                     }
                 }
+                if (region == Region::R1) {
+                    // already in the nearest region - no other view can improve it
+                    break;
+                }
             }
             proxy.prevRegion = proxy.region;
             proxy.region = region;
@@ -162,9 +176,30 @@ void Space::clear() {
     _proxies.clear();
     _owners.clear();
     _views.clear();
+    _proxiesChanged = true;
+    _viewsChanged = true;
 }
 
 void Space::setViews(const Views& views) {
+    // classification only reads the region spheres; when none of them moved, the
+    // categorize pass below has nothing it could change
+    bool changed = views.size() != _views.size();
+    if (!changed) {
+        for (size_t i = 0; i < views.size(); ++i) {
+            for (size_t k = 0; k < Region::NUM_TRACKED_REGIONS; ++k) {
+                if (views[i].regions[k] != _views[i].regions[k]) {
+                    changed = true;
+                    break;
+                }
+            }
+            if (changed) {
+                break;
+            }
+        }
+    }
+    if (changed) {
+        _viewsChanged = true;
+    }
     _views = views;
 }
 
@@ -66,6 +66,8 @@ private:
     std::vector<Owner> _owners;
 
     Views _views;
+    bool _viewsChanged { true };
+    bool _proxiesChanged { true };
 };
 
 using SpacePointer = std::shared_ptr<Space>;
@@ -22,7 +22,7 @@ public:
     QString getPreferredAudioOutDevice() const override;
     float getTargetFrameRate() const override;
 
-    virtual QJsonObject getHardwareStats() const;
+    virtual QJsonObject getHardwareStats() const override;
 
 protected:
     QThread::Priority getPresentPriority() override { return QThread::TimeCriticalPriority; }
@@ -0,0 +1,112 @@
+//
+//  AudioMixerBench.cpp
+//  tests/audio/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerBench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <AudioConstants.h>
+#include <AudioHRTF.h>
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+QTEST_MAIN(AudioMixerBench)
+
+static int envOrDefault(const char* name, int defaultValue) {
+    bool ok = false;
+    int value = qEnvironmentVariableIntValue(name, &ok);
+    return ok && value > 0 ? value : defaultValue;
+}
+
+void AudioMixerBench::benchmarkSwarmMix() {
+    // per listener the mixer renders every audible source through its HRTF,
+    // batched the same way AudioMixerSlave does
+    const int numSources = envOrDefault("HIFI_BENCH_SOURCES", 64);
+    const int numListeners = envOrDefault("HIFI_BENCH_LISTENERS", 8);
+    const int numTicks = envOrDefault("HIFI_BENCH_TICKS", 50);
+    const int HRTF_BATCH_SIZE = 16;
+    const int HRTF_DATASET_INDEX = 1;
+
+    // deterministic synthetic source content
+    std::vector<std::vector<int16_t>> sourceFrames(numSources);
+    uint32_t seed = 0x12345678;
+    for (int i = 0; i < numSources; i++) {
+        sourceFrames[i].resize(AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        for (auto& sample : sourceFrames[i]) {
+            seed = seed * 69069 + 1;
+            sample = (int16_t)(seed >> 17);
+        }
+    }
+
+    // one HRTF instance per (listener, source) pair, as in the mixer
+    std::vector<std::unique_ptr<AudioHRTF>> hrtfs;
+    hrtfs.reserve((size_t)numListeners * numSources);
+    for (int i = 0; i < numListeners * numSources; i++) {
+        hrtfs.emplace_back(new AudioHRTF());
+    }
+
+    std::vector<float> mixBuffer(AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
+    AudioHRTF::BatchSource batch[HRTF_BATCH_SIZE];
+    std::vector<quint64> tickTimes;
+    tickTimes.reserve(numTicks);
+
+    for (int tick = 0; tick < numTicks; tick++) {
+        quint64 tickStart = usecTimestampNow();
+        for (int listener = 0; listener < numListeners; listener++) {
+            memset(mixBuffer.data(), 0, mixBuffer.size() * sizeof(float));
+            int batchCount = 0;
+            for (int source = 0; source < numSources; source++) {
+                float azimuth = (source * TWO_PI) / numSources;
+                float distance = 1.0f + (source % 16);
+                batch[batchCount++] = { hrtfs[(size_t)listener * numSources + source].get(),
+                                        sourceFrames[source].data(), HRTF_DATASET_INDEX,
+                                        azimuth, distance, 1.0f / distance, LPF_DISTANCE_REF };
+                if (batchCount == HRTF_BATCH_SIZE) {
+                    AudioHRTF::renderBatch(batch, batchCount, mixBuffer.data(),
+                                           AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+                    batchCount = 0;
+                }
+            }
+            if (batchCount > 0) {
+                AudioHRTF::renderBatch(batch, batchCount, mixBuffer.data(),
+                                       AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+            }
+        }
+        tickTimes.push_back(usecTimestampNow() - tickStart);
+    }
+
+    // the mix should have produced something for every listener
+    float sum = 0.0f;
+    for (float sample : mixBuffer) {
+        sum += std::abs(sample);
+    }
+    QVERIFY(sum > 0.0f);
+
+    std::sort(tickTimes.begin(), tickTimes.end());
+    auto percentile = [&](float p) { return tickTimes[(size_t)(p * (tickTimes.size() - 1))]; };
+    double bytesPerTick = (double)numListeners * AudioConstants::NETWORK_FRAME_SAMPLES_STEREO * sizeof(int16_t);
+    double mbps = bytesPerTick * AudioConstants::NETWORK_FRAMES_PER_SEC / (1024.0 * 1024.0);
+
+    qInfo() << "swarm mix:" << numListeners << "listeners x" << numSources << "sources,"
+            << numTicks << "ticks";
+    qInfo() << "tick usecs p50:" << percentile(0.5f) << "p90:" << percentile(0.9f)
+            << "p99:" << percentile(0.99f) << "max:" << tickTimes.back();
+    qInfo() << "downstream payload at 100Hz:" << mbps << "MB/s";
+
+    // a tick must fit in the mixer's frame interval to sustain real-time at this load
+    quint64 budgetUsecs = (quint64)(AudioConstants::NETWORK_FRAME_SECS * USECS_PER_SECOND);
+    if (percentile(0.5f) > budgetUsecs) {
+        qWarning() << "median tick" << percentile(0.5f) << "usecs exceeds frame budget" << budgetUsecs;
+    }
+}
@@ -0,0 +1,25 @@
+//
+//  AudioMixerBench.h
+//  tests/audio/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerBench_h
+#define hifi_AudioMixerBench_h
+
+#include <QtTest/QtTest>
+
+// Synthetic-swarm load benchmark for the HRTF mixing kernel the audio mixer
+// runs per listener per source. Scale with HIFI_BENCH_SOURCES / HIFI_BENCH_LISTENERS /
+// HIFI_BENCH_TICKS to approximate event-sized load; defaults are CI-sized.
+class AudioMixerBench : public QObject {
+    Q_OBJECT
+private slots:
+    void benchmarkSwarmMix();
+};
+
+#endif // hifi_AudioMixerBench_h
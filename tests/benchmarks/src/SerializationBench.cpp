@@ -0,0 +1,151 @@
+//
+//  SerializationBench.cpp
+//  tests/benchmarks/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SerializationBench.h"
+
+#include <cmath>
+#include <vector>
+
+#include <ByteCountCoding.h>
+#include <GLMHelpers.h>
+#include <PropertyFlags.h>
+#include <SharedUtil.h>
+
+QTEST_MAIN(SerializationBench)
+
+static const int DEFAULT_ITERATIONS = 100000;
+
+static int benchIterations() {
+    bool ok = false;
+    int value = qEnvironmentVariableIntValue("HIFI_BENCH_ITERATIONS", &ok);
+    return ok && value > 0 ? value : DEFAULT_ITERATIONS;
+}
+
+// fixed-seed corpus generator, so runs are comparable across commits
+static uint32_t nextSeed(uint32_t& seed) {
+    seed = seed * 69069 + 1;
+    return seed;
+}
+
+void SerializationBench::benchmarkOrientationSixBytes() {
+    const int iterations = benchIterations();
+    const int CORPUS_SIZE = 256;
+
+    uint32_t seed = 0xfeedbeef;
+    std::vector<glm::quat> corpus(CORPUS_SIZE);
+    for (auto& rotation : corpus) {
+        glm::vec3 euler((nextSeed(seed) % 360) * 0.0174533f,
+                        (nextSeed(seed) % 360) * 0.0174533f,
+                        (nextSeed(seed) % 360) * 0.0174533f);
+        rotation = glm::quat(euler);
+    }
+
+    std::vector<unsigned char> packed(CORPUS_SIZE * 6);
+    std::vector<glm::quat> unpacked(CORPUS_SIZE);
+
+    quint64 packStart = usecTimestampNow();
+    for (int i = 0; i < iterations; i++) {
+        packOrientationQuatsToSixBytes(packed.data(), corpus.data(), CORPUS_SIZE);
+    }
+    quint64 packUsecs = usecTimestampNow() - packStart;
+
+    quint64 unpackStart = usecTimestampNow();
+    for (int i = 0; i < iterations; i++) {
+        unpackOrientationQuatsFromSixBytes(packed.data(), unpacked.data(), CORPUS_SIZE);
+    }
+    quint64 unpackUsecs = usecTimestampNow() - unpackStart;
+
+    // sanity: round trip must stay within quantization error
+    QVERIFY(fabsf(glm::dot(corpus[0], unpacked[0])) > 0.999f);
+
+    double totalQuats = (double)iterations * CORPUS_SIZE;
+    qInfo() << "packOrientationQuatsToSixBytes:" << (packUsecs * 1000.0 / totalQuats) << "ns/quat";
+    qInfo() << "unpackOrientationQuatsFromSixBytes:" << (unpackUsecs * 1000.0 / totalQuats) << "ns/quat";
+}
+
+void SerializationBench::benchmarkByteCountCoding() {
+    const int iterations = benchIterations();
+    const int CORPUS_SIZE = 256;
+
+    uint32_t seed = 0xcafe1234;
+    std::vector<quint64> corpus(CORPUS_SIZE);
+    for (auto& value : corpus) {
+        // mix of small (common case: counts, ids) and large values
+        value = (nextSeed(seed) % 4 == 0) ? nextSeed(seed) : (nextSeed(seed) & 0xff);
+    }
+
+    quint64 encodeStart = usecTimestampNow();
+    qint64 encodedBytes = 0;
+    for (int i = 0; i < iterations; i++) {
+        for (const auto& value : corpus) {
+            ByteCountCoded<quint64> coder(value);
+            encodedBytes += coder.encode().size();
+        }
+    }
+    quint64 encodeUsecs = usecTimestampNow() - encodeStart;
+
+    // pre-encode the corpus once for the decode pass
+    std::vector<QByteArray> encoded;
+    encoded.reserve(CORPUS_SIZE);
+    for (const auto& value : corpus) {
+        ByteCountCoded<quint64> coder(value);
+        encoded.push_back(coder.encode());
+    }
+
+    quint64 decodeStart = usecTimestampNow();
+    quint64 checksum = 0;
+    for (int i = 0; i < iterations; i++) {
+        for (const auto& bytes : encoded) {
+            ByteCountCoded<quint64> decoder;
+            decoder.decode(bytes);
+            checksum += decoder.data;
+        }
+    }
+    quint64 decodeUsecs = usecTimestampNow() - decodeStart;
+    QVERIFY(checksum > 0);
+    QVERIFY(encodedBytes > 0);
+
+    double totalValues = (double)iterations * CORPUS_SIZE;
+    qInfo() << "ByteCountCoded encode:" << (encodeUsecs * 1000.0 / totalValues) << "ns/value";
+    qInfo() << "ByteCountCoded decode:" << (decodeUsecs * 1000.0 / totalValues) << "ns/value";
+}
+
+void SerializationBench::benchmarkPropertyFlags() {
+    const int iterations = benchIterations();
+
+    // a typical edit packet touches a sparse set of high and low properties
+    PropertyFlags<int> corpus;
+    uint32_t seed = 0x5eed5eed;
+    for (int i = 0; i < 24; i++) {
+        corpus.setHasProperty((int)(nextSeed(seed) % 96));
+    }
+
+    quint64 encodeStart = usecTimestampNow();
+    qint64 encodedBytes = 0;
+    for (int i = 0; i < iterations; i++) {
+        PropertyFlags<int> flags = corpus;
+        encodedBytes += flags.encode().size();
+    }
+    quint64 encodeUsecs = usecTimestampNow() - encodeStart;
+    QVERIFY(encodedBytes > 0);
+
+    PropertyFlags<int> encoder = corpus;
+    QByteArray encoded = encoder.encode();
+
+    quint64 decodeStart = usecTimestampNow();
+    for (int i = 0; i < iterations; i++) {
+        PropertyFlags<int> decoded;
+        decoded.decode(encoded);
+    }
+    quint64 decodeUsecs = usecTimestampNow() - decodeStart;
+
+    qInfo() << "PropertyFlags encode:" << (encodeUsecs * 1000.0 / iterations) << "ns/op";
+    qInfo() << "PropertyFlags decode:" << (decodeUsecs * 1000.0 / iterations) << "ns/op";
+}
@@ -0,0 +1,27 @@
+//
+//  SerializationBench.h
+//  tests/benchmarks/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_SerializationBench_h
+#define hifi_SerializationBench_h
+
+#include <QtTest/QtTest>
+
+// Microbenchmarks for the serialization kernels that gate mixer and entity
+// server capacity. Inputs are generated from a fixed seed so numbers are
+// comparable across commits; scale iteration counts with HIFI_BENCH_ITERATIONS.
+class SerializationBench : public QObject {
+    Q_OBJECT
+private slots:
+    void benchmarkOrientationSixBytes();
+    void benchmarkByteCountCoding();
+    void benchmarkPropertyFlags();
+};
+
+#endif // hifi_SerializationBench_h
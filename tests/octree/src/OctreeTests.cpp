@@ -188,7 +188,32 @@ void OctreeTests::propertyFlagsTests() {
         QCOMPARE(encoded, makeQByteArray({ (char) 196, 15, 2 }));
     }
 
-    {    
+    {
+        if (verbose) {
+            qDebug() << "Test 5b: ExamplePropertyFlags: merging flags with += operator";
+        }
+        ExamplePropertyFlags props;
+        props += EXAMPLE_PROP_VISIBLE;
+        props += EXAMPLE_PROP_ANIMATION_URL;
+
+        ExamplePropertyFlags other;
+        other += EXAMPLE_PROP_ANIMATION_FPS;
+        other += EXAMPLE_PROP_ANIMATION_FRAME_INDEX;
+        other += EXAMPLE_PROP_ANIMATION_PLAYING;
+        other += EXAMPLE_PROP_PAUSE_SIMULATION;
+
+        props += other;
+
+        QByteArray encoded = props.encode();
+        QCOMPARE(encoded, makeQByteArray({ (char) 196, 15, 2 }));
+
+        // merging an empty flags object is a no-op
+        props += ExamplePropertyFlags();
+        encoded = props.encode();
+        QCOMPARE(encoded, makeQByteArray({ (char) 196, 15, 2 }));
+    }
+
+    {
         if (verbose) {
             qDebug() << "Test 6: ExamplePropertyFlags: using = ... << operator";
         }
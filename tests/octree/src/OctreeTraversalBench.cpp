@@ -0,0 +1,106 @@
+//
+//  OctreeTraversalBench.cpp
+//  tests/octree/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeTraversalBench.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <DiffTraversal.h>
+#include <EntityItem.h>
+#include <EntityItemProperties.h>
+#include <EntityTree.h>
+#include <EntityTreeElement.h>
+#include <NumericalConstants.h>
+#include <OctreeConstants.h>
+#include <SharedUtil.h>
+
+QTEST_MAIN(OctreeTraversalBench)
+
+static int envOrDefault(const char* name, int defaultValue) {
+    bool ok = false;
+    int value = qEnvironmentVariableIntValue(name, &ok);
+    return ok && value > 0 ? value : defaultValue;
+}
+
+void OctreeTraversalBench::benchmarkTraversal() {
+    const int numEntities = envOrDefault("HIFI_BENCH_ENTITIES", 2000);
+    const int numRounds = envOrDefault("HIFI_BENCH_ROUNDS", 50);
+    const int editsPerRound = envOrDefault("HIFI_BENCH_EDITS", 20);
+
+    // deterministic generated world: boxes scattered through the domain
+    EntityTreePointer tree = std::make_shared<EntityTree>();
+    uint32_t seed = 0x0c7ee123;
+    auto nextSeed = [&] { seed = seed * 69069 + 1; return seed; };
+    auto randomPosition = [&] {
+        return glm::vec3((nextSeed() % 1000) * (TREE_SCALE / 1000.0f),
+                         (nextSeed() % 1000) * (TREE_SCALE / 1000.0f),
+                         (nextSeed() % 1000) * (TREE_SCALE / 1000.0f));
+    };
+
+    std::vector<EntityItemID> entityIDs;
+    entityIDs.reserve(numEntities);
+    quint64 buildStart = usecTimestampNow();
+    for (int i = 0; i < numEntities; i++) {
+        EntityItemProperties properties;
+        properties.setType(EntityTypes::Box);
+        properties.setPosition(randomPosition());
+        properties.setDimensions(glm::vec3(0.5f));
+        EntityItemID entityID(QUuid::createUuid());
+        if (tree->addEntity(entityID, properties)) {
+            entityIDs.push_back(entityID);
+        }
+    }
+    quint64 buildUsecs = usecTimestampNow() - buildStart;
+    QVERIFY((int)entityIDs.size() == numEntities);
+
+    // a frustumless view traverses the whole tree, as the entity script server does
+    DiffTraversal::View view;
+    view.lodScaleFactor = 1.0f;
+
+    const uint64_t LARGE_BUDGET_USECS = 10 * USECS_PER_SECOND;
+
+    // full first-time scan
+    DiffTraversal traversal;
+    size_t elementsVisited = 0;
+    traversal.setScanCallback([&](DiffTraversal::VisibleElement&) { ++elementsVisited; });
+
+    quint64 firstScanStart = usecTimestampNow();
+    traversal.prepareNewTraversal(view, tree->getRoot());
+    traversal.traverse(LARGE_BUDGET_USECS);
+    quint64 firstScanUsecs = usecTimestampNow() - firstScanStart;
+    QVERIFY(traversal.finished());
+    QVERIFY(elementsVisited > 0);
+
+    // repeat traversals under synthetic edit churn
+    std::vector<quint64> roundTimes;
+    roundTimes.reserve(numRounds);
+    for (int round = 0; round < numRounds; round++) {
+        for (int edit = 0; edit < editsPerRound; edit++) {
+            const EntityItemID& entityID = entityIDs[nextSeed() % entityIDs.size()];
+            EntityItemProperties properties;
+            properties.setPosition(randomPosition());
+            tree->updateEntity(entityID, properties);
+        }
+
+        quint64 roundStart = usecTimestampNow();
+        traversal.prepareNewTraversal(view, tree->getRoot());
+        traversal.traverse(LARGE_BUDGET_USECS);
+        roundTimes.push_back(usecTimestampNow() - roundStart);
+    }
+
+    std::sort(roundTimes.begin(), roundTimes.end());
+    auto percentile = [&](float p) { return roundTimes[(size_t)(p * (roundTimes.size() - 1))]; };
+
+    qInfo() << "world build:" << numEntities << "entities in" << buildUsecs << "usecs";
+    qInfo() << "first scan:" << firstScanUsecs << "usecs," << elementsVisited << "elements";
+    qInfo() << "repeat scan usecs with" << editsPerRound << "edits/round - p50:" << percentile(0.5f)
+            << "p90:" << percentile(0.9f) << "p99:" << percentile(0.99f) << "max:" << roundTimes.back();
+}
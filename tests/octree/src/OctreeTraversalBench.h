@@ -0,0 +1,25 @@
+//
+//  OctreeTraversalBench.h
+//  tests/octree/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeTraversalBench_h
+#define hifi_OctreeTraversalBench_h
+
+#include <QtTest/QtTest>
+
+// Performance harness for entity tree traversal: full DiffTraversal scans and
+// repeat traversals under synthetic edit churn, over a deterministic generated
+// world. Scale with HIFI_BENCH_ENTITIES / HIFI_BENCH_ROUNDS / HIFI_BENCH_EDITS.
+class OctreeTraversalBench : public QObject {
+    Q_OBJECT
+private slots:
+    void benchmarkTraversal();
+};
+
+#endif // hifi_OctreeTraversalBench_h
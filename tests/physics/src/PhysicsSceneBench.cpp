@@ -0,0 +1,155 @@
+//
+//  PhysicsSceneBench.cpp
+//  tests/physics/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PhysicsSceneBench.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <btBulletDynamicsCommon.h>
+
+#include <PhysicsHelpers.h>
+#include <SharedUtil.h>
+
+QTEST_MAIN(PhysicsSceneBench)
+
+static int envOrDefault(const char* name, int defaultValue) {
+    bool ok = false;
+    int value = qEnvironmentVariableIntValue(name, &ok);
+    return ok && value > 0 ? value : defaultValue;
+}
+
+namespace {
+
+// owns a world configured the way PhysicsEngine configures its own
+struct BenchWorld {
+    btDefaultCollisionConfiguration collisionConfig;
+    btCollisionDispatcher dispatcher { &collisionConfig };
+    btDbvtBroadphase broadphase;
+    btSequentialImpulseConstraintSolver solver;
+    btDiscreteDynamicsWorld world { &dispatcher, &broadphase, &solver, &collisionConfig };
+
+    std::vector<std::unique_ptr<btCollisionShape>> shapes;
+    std::vector<std::unique_ptr<btMotionState>> motionStates;
+    std::vector<std::unique_ptr<btRigidBody>> bodies;
+
+    BenchWorld() {
+        world.setGravity(btVector3(0.0f, -9.8f, 0.0f));
+    }
+
+    ~BenchWorld() {
+        for (auto& body : bodies) {
+            world.removeRigidBody(body.get());
+        }
+    }
+
+    btRigidBody* addBody(btScalar mass, btCollisionShape* shape, const btTransform& transform) {
+        btVector3 inertia(0.0f, 0.0f, 0.0f);
+        if (mass > 0.0f) {
+            shape->calculateLocalInertia(mass, inertia);
+        }
+        motionStates.emplace_back(new btDefaultMotionState(transform));
+        bodies.emplace_back(new btRigidBody(mass, motionStates.back().get(), shape, inertia));
+        world.addRigidBody(bodies.back().get());
+        return bodies.back().get();
+    }
+};
+
+// order-sensitive hash over the exact bits of every dynamic body's transform
+uint64_t hashWorldState(const BenchWorld& bench) {
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&](btScalar value) {
+        uint32_t bits;
+        static_assert(sizeof(bits) == sizeof(float), "expects single-precision bullet");
+        float single = (float)value;
+        memcpy(&bits, &single, sizeof(bits));
+        hash = (hash ^ bits) * 1099511628211ULL;
+    };
+    for (const auto& body : bench.bodies) {
+        const btTransform& transform = body->getWorldTransform();
+        mix(transform.getOrigin().x());
+        mix(transform.getOrigin().y());
+        mix(transform.getOrigin().z());
+        btQuaternion rotation = transform.getRotation();
+        mix(rotation.x());
+        mix(rotation.y());
+        mix(rotation.z());
+        mix(rotation.w());
+    }
+    return hash;
+}
+
+struct RunResult {
+    uint64_t stateHash;
+    std::vector<quint64> stepTimes;
+};
+
+RunResult runAvalanche(int numBoxes, int numSteps) {
+    BenchWorld bench;
+
+    // static ground
+    bench.shapes.emplace_back(new btBoxShape(btVector3(100.0f, 1.0f, 100.0f)));
+    btTransform groundTransform;
+    groundTransform.setIdentity();
+    groundTransform.setOrigin(btVector3(0.0f, -1.0f, 0.0f));
+    bench.addBody(0.0f, bench.shapes.back().get(), groundTransform);
+
+    // a column of jittered boxes that collapses into an avalanche
+    bench.shapes.emplace_back(new btBoxShape(btVector3(0.25f, 0.25f, 0.25f)));
+    btCollisionShape* boxShape = bench.shapes.back().get();
+    uint32_t seed = 0xb0bb1e5;
+    auto nextSeed = [&] { seed = seed * 69069 + 1; return seed; };
+    for (int i = 0; i < numBoxes; i++) {
+        btTransform transform;
+        transform.setIdentity();
+        transform.setOrigin(btVector3(((int)(nextSeed() % 100) - 50) * 0.02f,
+                                      1.0f + i * 0.6f,
+                                      ((int)(nextSeed() % 100) - 50) * 0.02f));
+        bench.addBody(1.0f, boxShape, transform);
+    }
+
+    RunResult result;
+    result.stepTimes.reserve(numSteps);
+    for (int step = 0; step < numSteps; step++) {
+        quint64 stepStart = usecTimestampNow();
+        bench.world.stepSimulation(PHYSICS_ENGINE_FIXED_SUBSTEP, 0, PHYSICS_ENGINE_FIXED_SUBSTEP);
+        result.stepTimes.push_back(usecTimestampNow() - stepStart);
+    }
+    result.stateHash = hashWorldState(bench);
+    return result;
+}
+
+} // namespace
+
+void PhysicsSceneBench::benchmarkBoxAvalanche() {
+    const int numBoxes = envOrDefault("HIFI_BENCH_BOXES", 500);
+    const int numSteps = envOrDefault("HIFI_BENCH_STEPS", 300);
+
+    RunResult first = runAvalanche(numBoxes, numSteps);
+    RunResult second = runAvalanche(numBoxes, numSteps);
+
+    // identical scene + fixed substeps must produce bit-identical end states
+    QCOMPARE(second.stateHash, first.stateHash);
+
+    std::sort(first.stepTimes.begin(), first.stepTimes.end());
+    auto percentile = [&](float p) { return first.stepTimes[(size_t)(p * (first.stepTimes.size() - 1))]; };
+
+    qInfo() << "avalanche:" << numBoxes << "boxes," << numSteps << "steps";
+    qInfo() << "step usecs p50:" << percentile(0.5f) << "p90:" << percentile(0.9f)
+            << "p99:" << percentile(0.99f) << "max:" << first.stepTimes.back();
+
+    // the simulation budget per 90Hz frame
+    const quint64 BUDGET_USECS = 11000;
+    if (percentile(0.99f) > BUDGET_USECS) {
+        qWarning() << "p99 step" << percentile(0.99f) << "usecs exceeds" << BUDGET_USECS << "usec budget";
+    }
+}
@@ -0,0 +1,25 @@
+//
+//  PhysicsSceneBench.h
+//  tests/physics/src
+//
+//  Copyright 2021 Vircadia contributors.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_PhysicsSceneBench_h
+#define hifi_PhysicsSceneBench_h
+
+#include <QtTest/QtTest>
+
+// Scenario benchmark for the dynamics configuration PhysicsEngine uses: a box
+// avalanche stepped headlessly, with wall-time statistics and cross-run state
+// hashing to detect nondeterminism. Scale with HIFI_BENCH_BOXES / HIFI_BENCH_STEPS.
+class PhysicsSceneBench : public QObject {
+    Q_OBJECT
+private slots:
+    void benchmarkBoxAvalanche();
+};
+
+#endif // hifi_PhysicsSceneBench_h
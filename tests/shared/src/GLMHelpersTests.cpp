@@ -11,6 +11,9 @@
 
 #include "GLMHelpersTests.h"
 
+#include <cstring>
+#include <vector>
+
 #include <NumericalConstants.h>
 #include <StreamUtils.h>
 
@@ -105,6 +108,48 @@ void GLMHelpersTests::testSixByteOrientationCompression() {
     testQuatCompression(-(ROT_Z_30 * ROT_X_90 * ROT_Y_180));
 }
 
+void GLMHelpersTests::testBatchSixByteOrientationDecompression() {
+    // pack a skeleton's worth of varied rotations, then check that the batch
+    // decode is bit-identical to the per-quat decode
+    const int NUM_QUATS = 100;
+
+    std::vector<unsigned char> buffer(NUM_QUATS * 6);
+    unsigned char* cursor = buffer.data();
+    for (int i = 0; i < NUM_QUATS; i++) {
+        glm::quat q = glm::angleAxis(PI * (i / (float)NUM_QUATS) * 2.0f - PI,
+                                     glm::normalize(glm::vec3(sinf(i * 1.3f), cosf(i * 0.7f), sinf(i * 2.1f) + 1.01f)));
+        cursor += packOrientationQuatToSixBytes(cursor, q);
+    }
+
+    std::vector<glm::quat> batchOutput(NUM_QUATS);
+    int bytesRead = unpackOrientationQuatsFromSixBytes(buffer.data(), batchOutput.data(), NUM_QUATS);
+    QCOMPARE(bytesRead, NUM_QUATS * 6);
+
+    // the batch pack must produce byte-identical records to the scalar pack above
+    {
+        std::vector<glm::quat> sourceQuats(NUM_QUATS);
+        for (int i = 0; i < NUM_QUATS; i++) {
+            sourceQuats[i] = glm::angleAxis(PI * (i / (float)NUM_QUATS) * 2.0f - PI,
+                                            glm::normalize(glm::vec3(sinf(i * 1.3f), cosf(i * 0.7f), sinf(i * 2.1f) + 1.01f)));
+        }
+        std::vector<unsigned char> batchPacked(NUM_QUATS * 6);
+        int bytesWritten = packOrientationQuatsToSixBytes(batchPacked.data(), sourceQuats.data(), NUM_QUATS);
+        QCOMPARE(bytesWritten, NUM_QUATS * 6);
+        QCOMPARE(memcmp(batchPacked.data(), buffer.data(), NUM_QUATS * 6), 0);
+    }
+
+    const unsigned char* readCursor = buffer.data();
+    for (int i = 0; i < NUM_QUATS; i++) {
+        glm::quat scalarOutput;
+        readCursor += unpackOrientationQuatFromSixBytes(readCursor, scalarOutput);
+
+        QCOMPARE(batchOutput[i].x, scalarOutput.x);
+        QCOMPARE(batchOutput[i].y, scalarOutput.y);
+        QCOMPARE(batchOutput[i].z, scalarOutput.z);
+        QCOMPARE(batchOutput[i].w, scalarOutput.w);
+    }
+}
+
 #define LOOPS 500000
 
 void GLMHelpersTests::testSimd() {
@@ -7,6 +7,10 @@
 //
 
 #include "RenderThread.h"
+
+#include <algorithm>
+
+#include <QtCore/QDebug>
 #include <QtGui/QWindow>
 #include <gl/QOpenGLContextWrapper.h>
 
@@ -171,7 +175,23 @@ void RenderThread::renderFrame(gpu::FramePointer& frame) {
 
     //_gpuContext->enableStereo(true);
     if (frame && !frame->batches.empty()) {
+        auto executeStart = _elapsed.nsecsElapsed();
         _gpuContext->executeFrame(frame);
+        _executeTimes.push_back((uint64_t)(_elapsed.nsecsElapsed() - executeStart));
+
+        // report CPU translate/submit percentiles for the replayed scene so
+        // backend changes can be A/B'd against captures without the interface
+        static const size_t REPORT_WINDOW = 100;
+        if (_executeTimes.size() >= REPORT_WINDOW) {
+            std::sort(_executeTimes.begin(), _executeTimes.end());
+            auto percentile = [&](float p) {
+                return _executeTimes[(size_t)(p * (_executeTimes.size() - 1))] / 1000;
+            };
+            qDebug() << "executeFrame usecs over" << _executeTimes.size() << "frames -"
+                     << "p50:" << percentile(0.5f) << "p90:" << percentile(0.9f)
+                     << "p99:" << percentile(0.99f) << "batches:" << frame->batches.size();
+            _executeTimes.clear();
+        }
     }
 
 #ifdef USE_GL
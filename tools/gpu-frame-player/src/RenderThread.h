@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <QtCore/QElapsedTimer>
 
 #include <GenericThread.h>
@@ -49,6 +51,8 @@ public:
     std::shared_ptr<gpu::Backend> _backend;
     std::atomic<size_t> _presentCount{ 0 };
     QElapsedTimer _elapsed;
+    // per-frame executeFrame CPU times, reported as percentiles every window
+    std::vector<uint64_t> _executeTimes;
     size_t _frameIndex{ 0 };
     std::mutex _frameLock;
     std::queue<gpu::FramePointer> _pendingFrames;
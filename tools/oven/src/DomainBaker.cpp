@@ -167,10 +167,9 @@ void DomainBaker::addModelBaker(const QString& property, const QString& url, con
                 _modelBakers.insert(bakeableModelURL, baker);
                 haveBaker = true;
 
-                // move the baker to the baker thread
-                // and kickoff the bake
-                baker->moveToThread(Oven::instance().getNextWorkerThread());
-                QMetaObject::invokeMethod(baker.data(), "bake", Qt::QueuedConnection);
+                // hand the baker to the scheduler, which queues it for the
+                // next free worker thread
+                scheduleSubBake(baker.data());
 
                 // keep track of the total number of baking entities
                 ++_totalNumberOfSubBakes;
@@ -212,8 +211,7 @@ void DomainBaker::addTextureBaker(const QString& property, const QString& url, i
             _textureBakers.insert(key, textureBaker);
 
             // move the baker to a worker thread and kickoff the bake
-            textureBaker->moveToThread(Oven::instance().getNextWorkerThread());
-            QMetaObject::invokeMethod(textureBaker.data(), "bake", Qt::QueuedConnection);
+            scheduleSubBake(textureBaker.data());
 
             // keep track of the total number of baking entities
             ++_totalNumberOfSubBakes;
@@ -248,8 +246,7 @@ void DomainBaker::addScriptBaker(const QString& property, const QString& url, co
         _scriptBakers.insert(scriptURL, scriptBaker);
 
         // move the baker to a worker thread and kickoff the bake
-        scriptBaker->moveToThread(Oven::instance().getNextWorkerThread());
-        QMetaObject::invokeMethod(scriptBaker.data(), "bake", Qt::QueuedConnection);
+        scheduleSubBake(scriptBaker.data());
 
         // keep track of the total number of baking entities
         ++_totalNumberOfSubBakes;
@@ -285,8 +282,7 @@ void DomainBaker::addMaterialBaker(const QString& property, const QString& data,
         _materialBakers.insert(materialData, materialBaker);
 
         // move the baker to a worker thread and kickoff the bake
-        materialBaker->moveToThread(Oven::instance().getNextWorkerThread());
-        QMetaObject::invokeMethod(materialBaker.data(), "bake", Qt::QueuedConnection);
+        scheduleSubBake(materialBaker.data());
 
         // keep track of the total number of baking entities
         ++_totalNumberOfSubBakes;
@@ -427,7 +423,36 @@ void DomainBaker::enumerateEntities() {
     emit bakeProgress(0, _totalNumberOfSubBakes);
 }
 
+void DomainBaker::scheduleSubBake(QObject* baker) {
+    // start sub-bakes up to the worker count and queue the rest: the old
+    // round-robin pre-assignment could leave one slow thread holding a long
+    // tail of queued bakers while the other workers sat idle (see the FIXME in
+    // Oven::getNextWorkerThread). Concurrency - and therefore peak baking
+    // memory - stays bounded by the worker count.
+    if (_inflightSubBakes < Oven::instance().getWorkerThreadCount()) {
+        startSubBake(baker);
+    } else {
+        _queuedSubBakes.push_back(baker);
+    }
+}
+
+void DomainBaker::startSubBake(QObject* baker) {
+    ++_inflightSubBakes;
+    baker->moveToThread(Oven::instance().getNextWorkerThread());
+    QMetaObject::invokeMethod(baker, "bake", Qt::QueuedConnection);
+}
+
+void DomainBaker::subBakeFinished() {
+    --_inflightSubBakes;
+    if (!_queuedSubBakes.empty()) {
+        QObject* nextBaker = _queuedSubBakes.front();
+        _queuedSubBakes.pop_front();
+        startSubBake(nextBaker);
+    }
+}
+
 void DomainBaker::handleFinishedModelBaker() {
+    subBakeFinished();
     auto baker = qobject_cast<ModelBaker*>(sender());
 
     if (baker) {
@@ -499,6 +524,7 @@ void DomainBaker::handleFinishedModelBaker() {
 }
 
 void DomainBaker::handleFinishedTextureBaker() {
+    subBakeFinished();
     auto baker = qobject_cast<TextureBaker*>(sender());
 
     if (baker) {
@@ -575,6 +601,7 @@ void DomainBaker::handleFinishedTextureBaker() {
 }
 
 void DomainBaker::handleFinishedScriptBaker() {
+    subBakeFinished();
     auto baker = qobject_cast<JSBaker*>(sender());
 
     if (baker) {
@@ -649,6 +676,7 @@ void DomainBaker::handleFinishedScriptBaker() {
 }
 
 void DomainBaker::handleFinishedMaterialBaker() {
+    subBakeFinished();
     auto baker = qobject_cast<MaterialBaker*>(sender());
 
     if (baker) {
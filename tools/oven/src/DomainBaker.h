@@ -19,6 +19,8 @@
 #include <QtCore/QUrl>
 #include <QtCore/QThread>
 
+#include <list>
+
 #include "ModelBaker.h"
 #include "TextureBaker.h"
 #include "JSBaker.h"
@@ -77,6 +79,14 @@ private:
 
     bool _shouldRebakeOriginals { false };
 
+    // sub-bakes are started up to the worker count and queued beyond it, handed
+    // to threads as earlier bakes finish instead of pre-assigned round-robin
+    void scheduleSubBake(QObject* baker);
+    void startSubBake(QObject* baker);
+    void subBakeFinished();
+    std::list<QObject*> _queuedSubBakes;
+    int _inflightSubBakes { 0 };
+
     void addModelBaker(const QString& property, const QString& url, const QJsonValueRef& jsonRef);
     void addTextureBaker(const QString& property, const QString& url, image::TextureUsage::Type type, const QJsonValueRef& jsonRef);
     void addScriptBaker(const QString& property, const QString& url, const QJsonValueRef& jsonRef);
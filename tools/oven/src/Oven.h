@@ -27,6 +27,7 @@ public:
     static Oven& instance() { return *_staticInstance; }
 
     QThread* getNextWorkerThread();
+    int getWorkerThreadCount() const { return (int)_workerThreads.size(); }
 
 private:
     void setupWorkerThreads(int numWorkerThreads);